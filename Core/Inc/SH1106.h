@@ -67,6 +67,8 @@ SDA        |PB7          |Serial data line
 #ifndef SH1106_HEIGHT
 #define SH1106_HEIGHT           64
 #endif
+/* Pages of 8 pixel rows */
+#define SH1106_PAGES            (SH1106_HEIGHT / 8)
 
 /**
  * @brief  SH1106 color enumeration
@@ -88,12 +90,32 @@ uint8_t SH1106_Init(void);
 
 /** 
  * @brief  Updates buffer from internal RAM to LCD
- * @note   This function must be called each time you do some changes to LCD, to update buffer from RAM to LCD
+ * @note   This function must be called each time you do some changes to LCD, to update buffer from RAM to LCD.
+ *         The transfer runs over I2C DMA after it returns; a call while one is running is queued for @ref SH1106_Poll()
+ *         Does nothing unless @ref SH1106_Init() found the panel
  * @param  None
  * @retval None
  */
 void SH1106_UpdateScreen(void);
 
+/**
+ * @brief  Starts a flush queued while the last one was running, or a delayed retry of a failed one; call from the main loop
+ * @param  None
+ * @retval None
+ */
+void SH1106_Poll(void);
+
+/**
+ * @brief  Tells whether a flush is on the bus
+ * @param  None
+ * @retval Nonzero while a flush is in progress
+ */
+uint8_t SH1106_FlushBusy(void);
+
+uint32_t SH1106_BytesPerSecond(void);
+
+uint32_t SH1106_TotalBytes(void);
+
 /**
  * @brief  Toggles pixels invertion inside internal RAM
  * @note   @ref SH1106_UpdateScreen() must be called after that in order to see updated LCD screen
@@ -270,6 +292,19 @@ void SH1106_I2C_WriteMulti(uint8_t address, uint8_t reg, uint8_t *data, uint16_t
  */
 void SH1106_DrawBitmap(int16_t x, int16_t y, const unsigned char* bitmap, int16_t w, int16_t h, uint16_t color);
 
+/**
+ * @brief  Draws a sprite stored in the display's page-major layout, whole bytes at a time
+ * @note   Byte [page * w + i] holds column i of rows 8 * page to 8 * page + 7, top row in bit 0. Set bits are drawn
+ *         in color, clear bits leave the screen as it is. A y that is a multiple of 8 needs no shifting
+ * @param  x:  X location of the left edge. Valid input is 0 to SH1106_WIDTH - 1
+ * @param  y:  Y location of the top edge. Valid input is 0 to SH1106_HEIGHT - 1
+ * @param  *sprite : Pointer to the sprite
+ * @param  w : width of the sprite
+ * @param  h : height of the sprite
+ * @param  color : Color to be used. This parameter can be a value of @ref SH1106_COLOR_t enumeration
+ */
+void SH1106_DrawSprite(uint16_t x, uint16_t y, const uint8_t* sprite, uint16_t w, uint16_t h, SH1106_COLOR_t color);
+
 // scroll the screen for fixed rows
 
 void SH1106_ScrollRight(uint8_t start_row, uint8_t end_row);
@@ -0,0 +1,45 @@
+/*
+ *
+ *  Created on: 10/18/2026
+ *  ----------------------------------------------------------------------
+   	Copyright (C) Michael Kurta, 2024
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+ */
+
+// Batch sine / cosine.  On the H723 this drives the CORDIC co-processor in zero-overhead mode (write the angle,
+// read the results; the bus stalls until they are ready).  Any other build, e.g. the host, runs a software
+// CORDIC with the same Q1.31 formats and iteration count.
+
+#ifndef CORDIC_H_
+#define CORDIC_H_
+
+#include <stdint.h>
+
+#if defined(STM32H723xx)
+#define CORDIC_HW					1
+#else
+#define CORDIC_HW					0
+#endif
+
+#define CORDIC_ITERATIONS			24			// Peripheral PRECISION = 6 (4 iterations per step)
+
+void cordicInit(void);
+
+void cordicSinCos(const int32_t * angle, int32_t * sine, int32_t * cosine, uint16_t count);
+
+void cordicSinCosSoft(const int32_t * angle, int32_t * sine, int32_t * cosine, uint16_t count);
+
+#endif
@@ -0,0 +1,71 @@
+/*
+ *
+ *  Created on: 10/18/2026
+ *  ----------------------------------------------------------------------
+   	Copyright (C) Michael Kurta, 2024
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+ */
+
+// Direct digital synthesis engine.
+// The DAC runs at a fixed sample rate and a 32-bit phase accumulator steps through one output cycle per
+// 2^32 counts; the tuning word (phase step per sample) alone sets the output frequency.  This file has no
+// HAL dependencies so the same code can be compiled on the host as a reference model.
+
+#ifndef DDS_H_
+#define DDS_H_
+
+#include <stdint.h>
+
+#define DDS_SAMPLE_RATE_HZ			2750000		// TIM6 kernel clock 275 MHz / PSC 2 / ARR 50
+#define DDS_TABLE_SIZE				4000		// Entries in one cycle of the master table
+#define DDS_FULL_SCALE				4095		// 12-bit DAC code for the top of the waveform
+
+#define DDS_WAVE_SINE				0			// Same numbering as wGen->currentWaveSelected
+#define DDS_WAVE_SQUARE				1
+#define DDS_WAVE_RAMP				2
+#define DDS_WAVE_ARB				3			// User table, e.g. uploaded over USART3
+
+typedef struct {
+
+	uint32_t			phase;				// Phase accumulator, 2^32 = one output cycle
+	uint32_t			tuningWord;			// Phase step per DAC sample
+	uint32_t			dutyPhase;			// Phase where the square falls / the ramp peaks
+	uint64_t			riseGain;			// Ramp slope below dutyPhase (Q48)
+	uint64_t			fallGain;			// Ramp slope above dutyPhase (Q48)
+	uint8_t				waveform;
+	const uint16_t *	table;				// Master table used by DDS_WAVE_SINE, DDS_TABLE_SIZE entries
+	const uint16_t *	arbTable;			// One cycle used by DDS_WAVE_ARB
+	uint16_t			arbSize;			// Entries in arbTable
+
+} DDS_HandleTypeDef;
+
+DDS_HandleTypeDef dds_create(const uint16_t * table);
+
+uint32_t ddsTuningWord(uint32_t milliHz);
+
+uint32_t ddsActualMilliHz(uint32_t tuningWord);
+
+int32_t ddsErrorPpb(uint32_t milliHz, uint32_t tuningWord);
+
+void ddsFill(DDS_HandleTypeDef * dds, uint16_t * buf, uint16_t count);
+
+void ddsLoadSettings(DDS_HandleTypeDef * dds, const DDS_HandleTypeDef * next);
+
+void ddsSetDuty(DDS_HandleTypeDef * dds, uint16_t tenths);
+
+void ddsSetFrequency(DDS_HandleTypeDef * dds, uint32_t milliHz);
+
+#endif
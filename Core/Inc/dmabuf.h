@@ -0,0 +1,46 @@
+/*
+ *
+ *  Created on: 10/18/2026
+ *  ----------------------------------------------------------------------
+   	Copyright (C) Michael Kurta, 2024
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+ */
+
+// Cache maintenance for buffers shared with DMA.
+// DMA masters cannot see the M7 D-cache.  The buffers stay in ordinary .bss, where the stock CubeIDE linker
+// script puts them, cache-line aligned so maintenance on one never reaches into a neighbour's lines:
+//   DMA_BUFFER     CPU writes, DMA reads (DAC output, display flush, MDMA settings).  The writer cleans the
+//                  lines it changed with dmaBufferClean() before the stream can reach them.
+//   DMA_RX_BUFFER  DMA writes, CPU reads (UART receive).  The receive event drops the ring from the D-cache with
+//                  dmaBufferInvalidate() before the parser is told how far the stream has written.
+// Buffers another master writes into a DMA_BUFFER (the MDMA) are dropped with dmaBufferInvalidate() before and
+// after the transfer.  Sizes should be whole cache lines wherever a buffer is ever invalidated.
+
+#ifndef DMABUF_H_
+#define DMABUF_H_
+
+#include <stdint.h>
+
+#define DMA_CACHE_LINE				32
+
+#define DMA_BUFFER					__attribute__((aligned(DMA_CACHE_LINE)))
+#define DMA_RX_BUFFER				__attribute__((aligned(DMA_CACHE_LINE)))
+
+void dmaBufferClean(const void * addr, uint32_t bytes);
+
+void dmaBufferInvalidate(void * addr, uint32_t bytes);
+
+#endif
@@ -49,11 +49,14 @@ extern C {
 
 /**
  * @brief  Font structure used on my LCD libraries
+ * @note   Glyphs are stored column-wise in 8 pixel pages, the layout the SH1106 uses: each glyph is
+ *         FontWidth bytes per page for (FontHeight + 7) / 8 pages, byte [page * FontWidth + x] holding column x
+ *         of rows 8 * page to 8 * page + 7 with the top row in bit 0. Glyphs start at ' ' and run to '~'
  */
 typedef struct {
 	uint8_t FontWidth;    /*!< Font width in pixels */
 	uint8_t FontHeight;   /*!< Font height in pixels */
-	const uint16_t *data; /*!< Pointer to data font data array */
+	const uint8_t *data;  /*!< Pointer to data font data array */
 } FontDef_t;
 
 /** 
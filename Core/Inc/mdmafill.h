@@ -0,0 +1,60 @@
+/*
+ *
+ *  Created on: 10/18/2026
+ *  ----------------------------------------------------------------------
+   	Copyright (C) Michael Kurta, 2024
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+ */
+
+// Waveform buffer fills on the MDMA, for building cycles in the background while the CPU runs the UI.
+// One software-triggered channel does halfword copies, strided copies (decimation by a whole number) and constant
+// fills.  A square cycle is a two-node linked list, high then low, so it runs as one request.  Completion is
+// flagged from the MDMA interrupt; the caller polls mdmaFillDone() and finishes the cycle on the CPU.
+// Sources and destinations are cleaned out of the D-cache before a transfer and the destination is dropped from it
+// again when mdmaFillDone() first reports completion, so the CPU never reads lines from before the transfer.
+
+#ifndef MDMAFILL_H_
+#define MDMAFILL_H_
+
+#include "stm32h7xx_hal.h"
+
+#define MDMA_FILL_IRQ_PRIORITY		5			// Below the DAC streams, which must never wait on a fill
+
+typedef struct {
+
+	MDMA_HandleTypeDef		hmdma;
+	volatile uint8_t		busy;				// Set from the request until the transfer-complete interrupt
+	volatile uint8_t		failed;				// Set with busy cleared if the last transfer hit a bus error
+	uint16_t *				dst;				// Buffer of the last transfer, until mdmaFillDone() hands it back
+	uint16_t				count;
+
+} MdmaFill_HandleTypeDef;
+
+MdmaFill_HandleTypeDef mdmaFill_create(MDMA_Channel_TypeDef * channel);
+
+void mdmaFillInit(MdmaFill_HandleTypeDef * fill);
+
+uint8_t mdmaFillCopy(MdmaFill_HandleTypeDef * fill, uint16_t * dst, const uint16_t * src, uint16_t count,
+		uint16_t stride);
+
+uint8_t mdmaFillSquare(MdmaFill_HandleTypeDef * fill, uint16_t * dst, uint16_t count, uint16_t highCount,
+		uint16_t high, uint16_t low);
+
+uint8_t mdmaFillDone(MdmaFill_HandleTypeDef * fill);
+
+void mdmaFillIRQHandler(void);
+
+#endif
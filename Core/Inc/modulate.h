@@ -0,0 +1,68 @@
+/*
+ *
+ *  Created on: 10/18/2026
+ *  ----------------------------------------------------------------------
+   	Copyright (C) Michael Kurta, 2024
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+ */
+
+// AM / FM / PM modulation of the DDS output by an internal LFO.
+// The refill callback splits each half-buffer into MOD_BLOCK-sample blocks and calls modStep() before each one:
+// the LFO advances one step, FM offsets the tuning word from the carrier and PM moves the phase accumulator by the
+// change in phase offset, so both stay phase continuous.  modLevel() turns the same LFO value into a leveling
+// stage for AM.  The cost is per block, not per sample, so it is the same at any carrier frequency.  No HAL
+// dependencies, like dds.c.
+
+#ifndef MODULATE_H_
+#define MODULATE_H_
+
+#include <stdint.h>
+#include "dds.h"
+#include "synth.h"
+
+#define MOD_BLOCK					32			// Samples per LFO step, must divide DDS_BUF_SIZE / 2
+#define MOD_LFO_ONE					32767		// Peak LFO value (Q15)
+
+#define MOD_TYPE_AM					0
+#define MOD_TYPE_FM					1
+#define MOD_TYPE_PM					2
+
+#define MOD_SHAPE_SINE				0
+#define MOD_SHAPE_SQUARE			1
+#define MOD_SHAPE_RAMP				2			// Rising sawtooth
+
+typedef struct {
+
+	uint32_t			lfoPhase;			// 2^32 = one LFO cycle
+	uint32_t			lfoStep;			// LFO phase step per block
+	int32_t				depth;				// AM: Q15 fraction of the gain, FM: tuning word, PM: phase counts
+	int32_t				phaseOffset;		// PM offset currently in the DDS accumulator
+	uint8_t				type;
+	uint8_t				shape;
+	const uint16_t *	table;				// Master sine table, DDS_TABLE_SIZE entries
+	volatile uint8_t	active;
+
+} Mod_HandleTypeDef;
+
+Mod_HandleTypeDef mod_create(const uint16_t * table);
+
+uint8_t modConfigure(Mod_HandleTypeDef * mod, uint8_t type, uint8_t shape, uint32_t lfoStep, int32_t depth);
+
+Synth_LevelTypeDef modLevel(const Mod_HandleTypeDef * mod, Synth_LevelTypeDef level, int32_t lfo);
+
+int32_t modStep(Mod_HandleTypeDef * mod, DDS_HandleTypeDef * dds, uint32_t carrierWord);
+
+#endif
@@ -0,0 +1,61 @@
+/*
+ *
+ *  Created on: 10/18/2026
+ *  ----------------------------------------------------------------------
+   	Copyright (C) Michael Kurta, 2024
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+ */
+
+// Cycle-count profile of the time-critical paths, read from the DWT cycle counter (one count per 550 MHz
+// core clock).  Each slot keeps separate statistics for caches off and caches on, chosen by the D-cache state
+// when the measurement ends, so one session can compare both by switching with profileSetCaches().
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+#include "stm32h7xx_hal.h"
+
+#define PROFILE_SYNTH				0			// One table-path cycle or one DDS block, generated and leveled
+#define PROFILE_DISPLAY				1			// SH1106_UpdateScreen, CPU side only; the bus time runs on DMA
+#define PROFILE_DAC_ISR				2			// DMA1_Stream0 (DAC CH1) interrupt, HAL dispatch included
+#define PROFILE_SLOTS				3
+
+typedef struct {
+
+	uint32_t			count;
+	uint32_t			last;				// Cycles of the latest measurement
+	uint32_t			min;
+	uint32_t			max;
+	uint64_t			total;				// Sum of all measurements, total / count is the mean
+
+} Profile_SlotTypeDef;
+
+void profileInit(void);
+
+void profileReset(void);
+
+void profileSetCaches(uint8_t enabled);
+
+const Profile_SlotTypeDef * profileGet(uint8_t cached, uint8_t slot);
+
+// Cycle count at the start of a measured section; hand it to profileStop() at the end
+static inline uint32_t profileStart(void){
+	return DWT->CYCCNT;
+}
+
+void profileStop(uint8_t slot, uint32_t start);
+
+#endif
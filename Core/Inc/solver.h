@@ -0,0 +1,51 @@
+/*
+ *
+ *  Created on: 10/18/2026
+ *  ----------------------------------------------------------------------
+   	Copyright (C) Michael Kurta, 2024
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+ */
+
+
+// Table-mode timing solver.
+// The table path plays one waveform cycle of N samples per DMA loop, clocked by TIM6, so the output frequency is
+// TIM_CLOCK / ((PSC + 1) * (ARR + 1) * N).  solverFind() picks all three together to get as close as possible to a
+// requested frequency.  No HAL dependencies, so it can be exercised on the host.
+
+#ifndef SOLVER_H_
+#define SOLVER_H_
+
+#include <stdint.h>
+
+#define SOLVER_TIMER_CLOCK_HZ		275000000	// TIM6 kernel clock
+#define SOLVER_MIN_TICKS			26			// Fastest DAC update, ~10.6 MS/s (the old ARR_period table's limit)
+#define SOLVER_MIN_SAMPLES			10			// Fewest samples allowed in one cycle
+#define SOLVER_MAX_SAMPLES			4000		// TX_Bits capacity, MAX_SAMPLES_PER_REV
+#define SOLVER_GOOD_PPB				1000		// Errors at or below 1 ppm are accepted without searching further
+
+typedef struct {
+
+	uint16_t			prescaler;			// TIM6 PSC register value
+	uint16_t			period;				// TIM6 ARR register value
+	uint16_t			samples;			// Samples in one output cycle
+	uint32_t			actualMilliHz;		// Frequency the above settings produce
+	int32_t				errorPpb;			// (actual - requested) / requested, parts per billion (1000 = 1 ppm)
+
+} Solver_ResultTypeDef;
+
+uint8_t solverFind(uint32_t milliHz, Solver_ResultTypeDef * result);
+
+#endif
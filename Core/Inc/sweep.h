@@ -0,0 +1,57 @@
+/*
+ *
+ *  Created on: 10/18/2026
+ *  ----------------------------------------------------------------------
+   	Copyright (C) Michael Kurta, 2024
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+ */
+
+
+// Frequency sweep for the DDS engine.
+// A sweep is a list of tuning words, one per half-buffer refill, stepping linearly or geometrically from the start
+// word to the stop word.  The phase accumulator is untouched, so every step is phase continuous.  The running word
+// is kept in double precision (hardware on the Cortex-M7 FPU) so that millions of tiny steps do not drift.
+
+#ifndef SWEEP_H_
+#define SWEEP_H_
+
+#include <stdint.h>
+
+#define SWEEP_LAW_LINEAR			0			// Equal frequency steps
+#define SWEEP_LAW_LOG				1			// Equal frequency ratios, i.e. constant time per octave
+
+typedef struct {
+
+	double				tuningWord;			// Word for the next update, fractional so small steps accumulate
+	double				step;				// Added (linear) or multiplied in (log) once per update
+	uint32_t			startWord;
+	uint32_t			stopWord;
+	uint32_t			updates;			// Updates in one pass, start and stop included
+	uint32_t			position;			// Updates done in the current pass
+	uint8_t				law;
+	uint8_t				repeat;				// Restart from startWord at the end instead of holding stopWord
+	volatile uint8_t	active;
+
+} Sweep_HandleTypeDef;
+
+Sweep_HandleTypeDef sweep_create(void);
+
+uint8_t sweepConfigure(Sweep_HandleTypeDef * sweep, uint32_t startWord, uint32_t stopWord, uint32_t updates,
+		uint8_t law, uint8_t repeat);
+
+uint32_t sweepNext(Sweep_HandleTypeDef * sweep);
+
+#endif
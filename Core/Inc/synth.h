@@ -0,0 +1,70 @@
+/*
+ *
+ *  Created on: 10/18/2026
+ *  ----------------------------------------------------------------------
+   	Copyright (C) Michael Kurta, 2024
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+ */
+
+// Integer waveform kernels.  Each one writes exactly one cycle of 12-bit DAC codes and uses no floating point,
+// so the same inputs give the same buffer on every build and on the host.
+
+#ifndef SYNTH_H_
+#define SYNTH_H_
+
+#include <stdint.h>
+
+#define SYNTH_FULL_SCALE			4095		// Highest 12-bit DAC code
+#define SYNTH_Q30_ONE				(1L << 30)
+#define SYNTH_DUTY_FULL				1000		// Duty / symmetry arguments are in 0.1% steps
+#define SYNTH_GAIN_ONE				16384		// Unity gain in Synth_LevelTypeDef (Q14)
+#define SYNTH_BLEP_PHASES			64			// Edge positions per sample in the BLEP tables
+#define SYNTH_BLEP_TAPS				8			// Samples each edge correction spans
+
+typedef struct {
+
+	int16_t		gain;					// Q14 multiplier on the full-scale code, SYNTH_GAIN_ONE = unity
+	int16_t		base;					// Code added after scaling
+
+} Synth_LevelTypeDef;
+
+int32_t synthSinQ30(uint32_t phase);
+
+uint16_t synthQ30ToDac(int32_t value);
+
+void synthApplyLevel(const uint16_t * src, uint16_t * dst, uint16_t count, Synth_LevelTypeDef level);
+
+void synthDecimate(uint16_t * buf, uint16_t count, const uint16_t * table, uint16_t tableSize);
+
+uint32_t synthDutyEdge(uint16_t count, uint16_t tenths);
+
+Synth_LevelTypeDef synthLevel(uint16_t amplitude, int16_t offset);
+
+void synthRamp(uint16_t * buf, uint16_t count, uint16_t tenths);
+
+void synthRampBlamp(uint16_t * buf, uint16_t count, uint16_t tenths);
+
+void synthSine(uint16_t * buf, uint16_t count);
+
+void synthRotate(uint16_t * buf, uint16_t count, uint16_t shift);
+
+void synthSquare(uint16_t * buf, uint16_t count, uint16_t tenths);
+
+void synthSquareBlep(uint16_t * buf, uint16_t count, uint16_t tenths);
+
+void synthSquareSpan(uint16_t * buf, uint16_t count, uint16_t tenths, uint16_t start, uint16_t end);
+
+#endif
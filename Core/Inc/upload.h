@@ -0,0 +1,87 @@
+/*
+ *
+ *  Created on: 10/18/2026
+ *  ----------------------------------------------------------------------
+   	Copyright (C) Michael Kurta, 2024
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+ */
+
+
+// Arbitrary waveform upload over USART3.
+// The UART receives into a circular DMA ring with idle-line detection, so every burst from the host lands in the
+// ring and the RX event callback only moves the head index.  uploadPoll() runs from the main loop and parses:
+//
+//   'B' baud(u32)          switch baud rate, ACK sent at the old rate first
+//   'W' count(u16)         start a waveform of count samples (UPLOAD_MIN_SAMPLES..UPLOAD_MAX_SAMPLES)
+//   'D' n(u16) n x u16     a chunk of samples, 12-bit DAC codes, at most UPLOAD_MAX_CHUNK per chunk
+//   'C'                    commit once every sample has arrived
+//   'K' on(u8)             turn the CPU caches off (0) or on (1)
+//   'P'                    ACK, then the cycle-count profile: for caches off then on, each PROFILE_* slot as
+//                          count, min, max and mean cycles, u32 each
+//
+// All values little endian.  Each command is answered with UPLOAD_ACK or UPLOAD_NAK, and the host waits for it
+// before sending the next, which also keeps a chunk from ever overrunning the ring.  Samples are written into
+// the idle one of two waveform buffers, so the waveform being played is never touched.
+
+#ifndef UPLOAD_H_
+#define UPLOAD_H_
+
+#include "stm32h7xx_hal.h"
+
+#define UPLOAD_RING_SIZE			1024		// DMA receive ring, bytes
+#define UPLOAD_MAX_CHUNK			256			// Samples per 'D' command, must fit in the ring
+#define UPLOAD_MIN_SAMPLES			2
+#define UPLOAD_MAX_SAMPLES			4000		// MAX_SAMPLES_PER_REV
+#define UPLOAD_TIMEOUT_MS			500			// A command left unfinished this long is dropped
+#define UPLOAD_MIN_BAUD				1200
+#define UPLOAD_MAX_BAUD				8593750		// D2PCLK1 137.5 MHz / 16x oversampling
+
+#define UPLOAD_ACK					0x06
+#define UPLOAD_NAK					0x15
+
+typedef struct {
+
+	UART_HandleTypeDef *	huart;
+	volatile uint16_t		head;				// Ring write index, moved by the RX event callback
+	uint16_t				tail;				// Ring read index
+	volatile uint8_t		restarted;			// Set whenever reception restarts at index 0 (uploadStart, error callback)
+	uint8_t					state;
+	uint8_t					command;
+	uint8_t					args[4];
+	uint8_t					argCount;
+	uint8_t					argLen;
+	uint8_t					lowByte;			// First byte of a sample while waiting for the second
+	uint8_t					haveLow;
+	uint16_t				chunkLeft;			// Samples (or discarded bytes) still due in the current chunk
+	uint16_t				expected;			// Samples announced by 'W', 0 when no upload is open
+	uint16_t				received;
+	uint8_t					spare;				// Index of the waveform buffer being written
+	uint8_t					ready;				// Set when a committed waveform is waiting for uploadAccept()
+	uint32_t				lastByte;			// HAL_GetTick() of the last parsed byte
+
+} Upload_HandleTypeDef;
+
+Upload_HandleTypeDef upload_create(UART_HandleTypeDef * huart);
+
+HAL_StatusTypeDef uploadStart(Upload_HandleTypeDef * upload);
+
+HAL_StatusTypeDef uploadSetBaud(Upload_HandleTypeDef * upload, uint32_t baud);
+
+const uint16_t * uploadPoll(Upload_HandleTypeDef * upload, uint16_t * size);
+
+void uploadAccept(Upload_HandleTypeDef * upload);
+
+#endif
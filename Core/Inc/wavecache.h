@@ -0,0 +1,77 @@
+/*
+ *
+ *  Created on: 10/18/2026
+ *  ----------------------------------------------------------------------
+   	Copyright (C) Michael Kurta, 2024
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+ */
+
+
+// Cache of ready-built table-path cycles.
+// Each slot holds one leveled cycle exactly as DMA plays it, keyed by everything that shapes it.  The caller owns
+// the storage and does the filling; this file only does lookup, LRU replacement and hit / miss counting, and has
+// no HAL dependencies.
+
+#ifndef WAVECACHE_H_
+#define WAVECACHE_H_
+
+#include <stdint.h>
+#include "synth.h"
+
+#define WAVE_CACHE_SLOTS			8
+
+typedef struct {
+
+	uint8_t				waveform;			// Same numbering as wGen->currentWaveSelected
+	uint8_t				bandLimited;
+	uint16_t			samples;			// Samples per cycle
+	uint16_t			dutyTenths;			// 0 for waveforms without a duty setting
+	Synth_LevelTypeDef	level;
+	uint32_t			arbSerial;			// Upload the ARB cycle came from, 0 for other waveforms
+
+} WaveCache_KeyTypeDef;
+
+typedef struct {
+
+	WaveCache_KeyTypeDef	key;
+	uint16_t *				buffer;
+	uint32_t				lastUsed;		// cache clock at the last hit or fill, for LRU replacement
+	uint8_t					valid;
+
+} WaveCache_SlotTypeDef;
+
+typedef struct {
+
+	WaveCache_SlotTypeDef	slot[WAVE_CACHE_SLOTS];
+	uint32_t				clock;
+	uint32_t				hits;			// waveCacheFind() calls that found a cycle
+	uint32_t				misses;			// waveCacheFind() calls that did not
+	uint32_t				fills;			// Cycles committed
+
+} WaveCache_HandleTypeDef;
+
+WaveCache_HandleTypeDef waveCache_create(uint16_t * storage, uint16_t slotSize);
+
+uint16_t * waveCacheClaim(WaveCache_HandleTypeDef * cache, const WaveCache_KeyTypeDef * key,
+		const uint16_t * keepA, const uint16_t * keepB);
+
+void waveCacheCommit(WaveCache_HandleTypeDef * cache, const uint16_t * buffer);
+
+uint8_t waveCacheContains(const WaveCache_HandleTypeDef * cache, const WaveCache_KeyTypeDef * key);
+
+uint16_t * waveCacheFind(WaveCache_HandleTypeDef * cache, const WaveCache_KeyTypeDef * key);
+
+#endif
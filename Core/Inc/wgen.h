@@ -44,6 +44,9 @@
 #define CURSOR_TX_YPOS				18
 #define CURSOR_TX_XPOS				85
 
+#define DUTY_MIN_TENTHS				10			// 1%
+#define DUTY_MAX_TENTHS				990			// 99%
+
 #define DEFAULT_HZ					100
 #define MAX_FREQ_KHZ				200
 
@@ -51,21 +54,25 @@
 
 #define RESOLUTION_12BIT			4096
 
+#define DAC_FULL_SCALE				4095
+#define DAC_VREF_MV					3300		// VREF+ tied to VDDA
+#define DAC_MV_TO_CODES(mv)			((int32_t)(mv) * DAC_FULL_SCALE / DAC_VREF_MV)
+
 #define ROTARY_DIRECTION_ANTICLOCK	-1
 #define ROTARY_DIRECTION_NONE		0
 #define ROTARY_DIRECTION_CLOCK		1
 
-#define TX_BUF_SIZE_MAX_250_HZ		4000
-#define TX_BUF_SIZE_MAX_500_HZ		2000
-#define TX_BUF_SIZE_MAX_5000_HZ		1000
-#define TX_BUF_SIZE_MAX_10000_HZ	500
-#define TX_BUF_SIZE_MAX_20000_HZ	250
-#define TX_BUF_SIZE_MAX_100000_HZ	100
-#define TX_BUF_SIZE_MAX_200000_HZ	50
-#define TX_BUF_SIZE_MAX_999000_HZ	10
-
 #define TIMX_UG_BIT					0
 
+#define OUTPUT_MODE_TABLE			0			// One cycle per buffer, TIM6 ARR sets the frequency
+#define OUTPUT_MODE_DDS				1			// Fixed DAC rate, phase accumulator sets the frequency
+
+#define DDS_TIM6_PRESCALER			(2 - 1)		// TIM6 PSC for DDS_SAMPLE_RATE_HZ
+#define DDS_TIM6_PERIOD				(50 - 1)	// TIM6 ARR giving DDS_SAMPLE_RATE_HZ
+#define DDS_BUF_SIZE				1024		// Circular DMA buffer, refilled one half at a time
+#define DDS_MAX_MILLIHZ				((DDS_SAMPLE_RATE_HZ / 10) * 1000UL)	// 10 samples per cycle, as the table path
+#define MOD_MAX_RATE_MILLIHZ		10000000	// Fastest LFO, ~8.6 steps per cycle at one step per MOD_BLOCK samples
+
 
 #define DISPLAY_UNITS_KHZ			1
 #define DISPLAY_UNITS_HZ			0
@@ -74,6 +81,8 @@
 #include "stm32h7xx_hal.h"
 #include "stdio.h"
 #include "main.h"
+#include "sweep.h"
+#include "modulate.h"
 
 typedef struct {
 
@@ -84,8 +93,21 @@ typedef struct {
     uint16_t 	currentStateClk;		// Input from rotary encoder (CLK)
     int8_t		currentMenuPos;			// Main menu Pos
     uint8_t		currentWaveSelected;	// Wave type
-    uint8_t		currentPercent;			// Pulse duty % -> square wave //
-    uint32_t	frequency;
+    uint8_t		currentPercent;			// dutyTenths rounded to whole %, for the display and sprites
+    uint16_t	dutyTenths;				// Duty (square) / symmetry (ramp) in 0.1% steps
+    uint32_t	frequency;				// Front panel frequency, whole Hz
+    uint32_t	milliHz;				// Requested output frequency, mHz
+    uint32_t	actualMilliHz;			// Frequency the output engine is producing, mHz
+    int32_t		errorPpb;				// (actual - requested) / requested, parts per billion
+    uint8_t		outputMode;				// OUTPUT_MODE_TABLE or OUTPUT_MODE_DDS
+    uint8_t		ch2Enabled;				// DAC1 CH2 (PA5) output on
+    uint8_t		ch2Waveform;			// CH2 wave type, same numbering as currentWaveSelected
+    uint16_t	ch2Phase;				// CH2 phase lead over CH1, tenths of a degree
+    uint16_t	amplitude;				// CH1 peak-to-peak, DAC codes
+    int16_t		dcOffset;				// CH1 centre relative to mid-scale, DAC codes
+    uint16_t	ch2Amplitude;
+    int16_t		ch2DcOffset;
+    uint8_t		bandLimited;			// Table-path square and ramp use BLEP / BLAMP edges
     uint8_t		isPressed;
     uint8_t		isTransmitting;
     uint32_t 	lastUpdate;
@@ -112,8 +134,12 @@ wGen_HandleTypeDef wGen_create();
 
 void lcdInit(wGen_HandleTypeDef * wGen);
 
+void arb(wGen_HandleTypeDef * wGen);
+
 void buttonUpdate(wGen_HandleTypeDef * wGen);
 
+void cacheUpdate(wGen_HandleTypeDef * wGen);
+
 void checkSampleChange(wGen_HandleTypeDef * wGen);
 
 void consumeClick(wGen_HandleTypeDef * wGen);
@@ -122,6 +148,8 @@ void eraseCursor(wGen_HandleTypeDef * wGen);
 
 void exitToMain(wGen_HandleTypeDef * wGen);
 
+void getArbVal(wGen_HandleTypeDef * wGen);
+
 void getRampVal(wGen_HandleTypeDef * wGen);
 
 void getSamples(wGen_HandleTypeDef * wGen);
@@ -130,6 +158,16 @@ void getSquareVal(wGen_HandleTypeDef * wGen);
 
 void getSineVal(wGen_HandleTypeDef * wGen);
 
+uint32_t getCacheHits(void);
+
+uint32_t getCacheMisses(void);
+
+uint32_t getRefillMisses(void);
+
+void initOutput(wGen_HandleTypeDef * wGen);
+
+void loadArbWaveform(wGen_HandleTypeDef * wGen, const uint16_t * table, uint16_t size);
+
 void loopUpdate(wGen_HandleTypeDef * wGen);
 
 void ramp(wGen_HandleTypeDef * wGen);
@@ -148,10 +186,34 @@ void selectTransmit(wGen_HandleTypeDef * wGen);
 
 void selectWaveform(wGen_HandleTypeDef * wGen);
 
+void setOutputMode(wGen_HandleTypeDef * wGen, uint8_t mode);
+
+void setChannel2(wGen_HandleTypeDef * wGen, uint8_t enabled, uint8_t waveform, uint16_t phase);
+
+void setDuty(wGen_HandleTypeDef * wGen, uint16_t tenths);
+
+void setBandLimited(wGen_HandleTypeDef * wGen, uint8_t enabled);
+
+void setLevel(wGen_HandleTypeDef * wGen, uint8_t channel, uint16_t amplitude, int16_t offset);
+
+// Accuracy: DDS mode steps in DDS_SAMPLE_RATE_HZ / 2^32 (~0.64 mHz), so the error is at most 0.32 mHz, under 1 ppm
+// above 320 Hz; it goes no higher than DDS_MAX_MILLIHZ, where a cycle still has 10 samples.  Table mode is within 1 ppm whenever solverFind() finds a near-exact PSC / ARR / samples split,
+// otherwise errorPpb reports what is left
+uint8_t setFrequencyMilliHz(wGen_HandleTypeDef * wGen, uint32_t milliHz);
+
 void sine(wGen_HandleTypeDef * wGen);
 
 void square(wGen_HandleTypeDef * wGen);
 
+uint8_t startSweep(wGen_HandleTypeDef * wGen, uint32_t startMilliHz, uint32_t stopMilliHz, uint32_t durationMs,
+		uint8_t law, uint8_t repeat);
+
+void stopSweep(wGen_HandleTypeDef * wGen);
+
+uint8_t startModulation(wGen_HandleTypeDef * wGen, uint8_t type, uint8_t shape, uint32_t rateMilliHz, uint32_t depth);
+
+void stopModulation(wGen_HandleTypeDef * wGen);
+
 void updateBitmap(wGen_HandleTypeDef * wGen);
 
 void updateOutputFrequency(wGen_HandleTypeDef * wGen);
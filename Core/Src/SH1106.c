@@ -21,6 +21,8 @@
    ----------------------------------------------------------------------
  */
 #include "SH1106.h"
+#include "dmabuf.h"
+#include "profile.h"
 
 extern I2C_HandleTypeDef hi2c1;
 #define SH1106_I2C &hi2c1
@@ -35,8 +37,53 @@ extern I2C_HandleTypeDef hi2c1;
 /* Absolute value */
 #define ABS(x)   ((x) > 0 ? (x) : -(x))
 
-/* SH1106 data buffer */
-static uint8_t SH1106_Buffer[SH1106_WIDTH * SH1106_HEIGHT / 8];
+/* SH1106 data buffer, page-major so each dirty span is contiguous and the flush DMA reads it in place */
+DMA_BUFFER static uint8_t SH1106_Buffer[SH1106_WIDTH * SH1106_HEIGHT / 8];
+
+/* Changed columns of each page since the last flush, DirtyFirst > DirtyLast when the page is clean */
+static uint8_t SH1106_DirtyFirst[SH1106_PAGES];
+static uint8_t SH1106_DirtyLast[SH1106_PAGES];
+
+/* Bytes put on the I2C bus, and the count for the last whole second */
+static uint32_t SH1106_BytesSent;
+static uint32_t SH1106_WindowStart;
+static uint32_t SH1106_WindowBytes;
+static uint32_t SH1106_Rate;
+
+/* Flush pipeline: each dirty page is a command transfer, then the 0x40 control byte and the data span sent
+   as two frames of one I2C write (no restart between them), chained from the I2C transfer-complete
+   interrupt.  The data frame is read straight out of SH1106_Buffer; a column drawn while it is on the bus
+   is marked dirty again and goes out with the next flush */
+#define SH1106_FLUSH_IDLE          0
+#define SH1106_FLUSH_COMMAND       1
+#define SH1106_FLUSH_CONTROL       2
+#define SH1106_FLUSH_DATA          3
+
+/* A failed flush is retried this many times, each after SH1106_RETRY_DELAY ms, before the next redraw has to
+   ask again; a panel that has dropped off the bus then costs one attempt per redraw, not one per loop pass */
+#define SH1106_FLUSH_RETRIES       3
+#define SH1106_RETRY_DELAY         100
+
+DMA_BUFFER static uint8_t SH1106_FlushCommand[4];
+DMA_BUFFER static uint8_t SH1106_FlushControl;
+static uint8_t SH1106_FlushFirst[SH1106_PAGES];
+static uint8_t SH1106_FlushLast[SH1106_PAGES];
+static volatile uint8_t SH1106_FlushState;
+static volatile uint8_t SH1106_FlushPage;
+static volatile uint8_t SH1106_FlushFailed;
+static volatile uint8_t SH1106_FlushRequested;
+static volatile uint8_t SH1106_FlushRetries;
+static volatile uint32_t SH1106_FailTick;
+
+static void SH1106_MarkDirty(uint8_t page, uint8_t x);
+static void SH1106_MarkAllDirty(void);
+static void SH1106_CountBytes(uint16_t count);
+static void SH1106_StartFlush(void);
+static void SH1106_FlushNext(void);
+static void SH1106_WaitFlush(void);
+static uint8_t SH1106_Backoff(void);
+static void SH1106_Blit(uint8_t page, uint8_t x, const uint8_t* src, uint8_t count, uint8_t mask, int8_t shift, SH1106_COLOR_t color, uint8_t opaque);
+static void SH1106_FillColumns(uint8_t page, uint8_t x, uint8_t count, uint8_t mask, SH1106_COLOR_t color);
 
 /* Private SH1106 structure */
 typedef struct {
@@ -91,34 +138,213 @@ uint8_t SH1106_Init(void) {
 	SH1106_WRITECOMMAND(0xAF); //--turn on SH1106 panel
 
 
-	/* Clear screen */
-	SH1106_Fill(SH1106_COLOR_BLACK);
-	
-	/* Update screen */
-	SH1106_UpdateScreen();
-	
 	/* Set default values */
 	SH1106.CurrentX = 0;
 	SH1106.CurrentY = 0;
 	
-	/* Initialized OK */
+	/* Initialized OK, which lets the flush below go out */
 	SH1106.Initialized = 1;
 	
+	/* Clear screen.  The panel's RAM is random at power-up, so all of it is sent, not just what changed */
+	SH1106_Fill(SH1106_COLOR_BLACK);
+	SH1106_MarkAllDirty();
+	
+	/* Update screen */
+	SH1106_UpdateScreen();
+	
 	/* Return OK */
 	return 1;
 }
 
+/* Starts sending the changed column span of each changed page and returns at once; the transfers run from
+   the I2C interrupt.  A call while a flush is running is remembered and picked up by SH1106_Poll(), so a
+   burst of redraws costs one more flush, not one each.  Does nothing until SH1106_Init() has found the panel */
 void SH1106_UpdateScreen(void) {
+	uint32_t start;
+	
+	if (!SH1106.Initialized) {
+		return;
+	}
+	start = profileStart();
+	
+	if (SH1106_FlushState != SH1106_FLUSH_IDLE || SH1106_Backoff()) {
+		SH1106_FlushRequested = 1;
+	} else {
+		SH1106_StartFlush();
+	}
+	profileStop(PROFILE_DISPLAY, start);
+}
+
+/* Call from the main loop: starts a flush that was asked for while the last one was running, or a retry of one
+   that failed once its delay is up */
+void SH1106_Poll(void) {
+	if (!SH1106.Initialized) {
+		return;
+	}
+	if (SH1106_FlushRequested && SH1106_FlushState == SH1106_FLUSH_IDLE && !SH1106_Backoff()) {
+		SH1106_StartFlush();
+	}
+}
+
+/* Nonzero while a flush is on the bus */
+uint8_t SH1106_FlushBusy(void) {
+	return SH1106_FlushState != SH1106_FLUSH_IDLE;
+}
+
+static void SH1106_StartFlush(void) {
 	uint8_t m;
 	
-	for (m = 0; m < 8; m++) {
-		SH1106_WRITECOMMAND(0xB0 + m);
-		SH1106_WRITECOMMAND(0x00);
-		SH1106_WRITECOMMAND(0x10);
+	SH1106_FlushRequested = 0;
+	
+	/* A flush cut short by a bus error left the panel part written, so send everything */
+	if (SH1106_FlushFailed) {
+		SH1106_FlushFailed = 0;
+		SH1106_MarkAllDirty();
+	}
+	
+	/* Take over the dirty spans and push them out of the D-cache; anything drawn from here on is marked again */
+	for (m = 0; m < SH1106_PAGES; m++) {
+		uint8_t first = SH1106_DirtyFirst[m];
+		uint8_t last = SH1106_DirtyLast[m];
+		
+		SH1106_FlushFirst[m] = first;
+		SH1106_FlushLast[m] = last;
+		if (first <= last) {
+			dmaBufferClean(&SH1106_Buffer[SH1106_WIDTH * m + first], last - first + 1);
+		}
+		SH1106_DirtyFirst[m] = SH1106_WIDTH;
+		SH1106_DirtyLast[m] = 0;
+	}
+	
+	SH1106_FlushPage = 0;
+	SH1106_FlushState = SH1106_FLUSH_COMMAND;
+	SH1106_FlushNext();
+}
+
+/* Queues the next transfer of the running flush, or goes idle after the last page */
+static void SH1106_FlushNext(void) {
+	uint8_t m = SH1106_FlushPage;
+	
+	if (SH1106_FlushState == SH1106_FLUSH_COMMAND) {
+		/* Skip clean pages */
+		while (m < SH1106_PAGES && SH1106_FlushFirst[m] > SH1106_FlushLast[m]) {
+			m++;
+		}
+		SH1106_FlushPage = m;
+		if (m >= SH1106_PAGES) {
+			SH1106_FlushRetries = 0;
+			SH1106_FlushState = SH1106_FLUSH_IDLE;
+			return;
+		}
+		
+		/* Page, then column low and high nibble, behind one command control byte */
+		SH1106_FlushCommand[0] = 0x00;
+		SH1106_FlushCommand[1] = 0xB0 + m;
+		SH1106_FlushCommand[2] = 0x00 | (SH1106_FlushFirst[m] & 0x0F);
+		SH1106_FlushCommand[3] = 0x10 | (SH1106_FlushFirst[m] >> 4);
+		dmaBufferClean(SH1106_FlushCommand, sizeof(SH1106_FlushCommand));
+		
+		SH1106_FlushState = SH1106_FLUSH_CONTROL;
+		SH1106_CountBytes(sizeof(SH1106_FlushCommand));
+		if (HAL_I2C_Master_Transmit_DMA(SH1106_I2C, SH1106_I2C_ADDR, SH1106_FlushCommand, sizeof(SH1106_FlushCommand)) != HAL_OK) {
+			HAL_I2C_ErrorCallback(SH1106_I2C);
+		}
+	} else if (SH1106_FlushState == SH1106_FLUSH_CONTROL) {
+		/* Start and control byte, holding the bus for the data frame.  OTHER_FRAME forces the start, which the
+		   HAL would otherwise leave out after the command transfer in the same direction */
+		SH1106_FlushControl = 0x40;
+		dmaBufferClean(&SH1106_FlushControl, 1);
+		
+		SH1106_FlushState = SH1106_FLUSH_DATA;
+		SH1106_CountBytes(1);
+		if (HAL_I2C_Master_Seq_Transmit_DMA(SH1106_I2C, SH1106_I2C_ADDR, &SH1106_FlushControl, 1, I2C_OTHER_FRAME) != HAL_OK) {
+			HAL_I2C_ErrorCallback(SH1106_I2C);
+		}
+	} else {
+		/* The span itself, then stop */
+		uint8_t first = SH1106_FlushFirst[m];
+		uint16_t count = SH1106_FlushLast[m] - first + 1;
 		
-		/* Write multi data */
-		SH1106_I2C_WriteMulti(SH1106_I2C_ADDR, 0x40, &SH1106_Buffer[SH1106_WIDTH * m], SH1106_WIDTH);
+		SH1106_FlushPage = m + 1;
+		SH1106_FlushState = SH1106_FLUSH_COMMAND;
+		SH1106_CountBytes(count);
+		if (HAL_I2C_Master_Seq_Transmit_DMA(SH1106_I2C, SH1106_I2C_ADDR, &SH1106_Buffer[SH1106_WIDTH * m + first], count, I2C_LAST_FRAME) != HAL_OK) {
+			HAL_I2C_ErrorCallback(SH1106_I2C);
+		}
+	}
+}
+
+/* Nonzero while the last flush failed and its retry delay is still running */
+static uint8_t SH1106_Backoff(void) {
+	return SH1106_FlushFailed && HAL_GetTick() - SH1106_FailTick < SH1106_RETRY_DELAY;
+}
+
+/* The blocking command writes share the bus, so they wait for a running flush to finish first */
+static void SH1106_WaitFlush(void) {
+	while (SH1106_FlushState != SH1106_FLUSH_IDLE) {
+	}
+}
+
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c) {
+	if (hi2c == SH1106_I2C && SH1106_FlushState != SH1106_FLUSH_IDLE) {
+		SH1106_FlushNext();
+	}
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c) {
+	if (hi2c == SH1106_I2C) {
+		/* Give up on this flush and resend the whole panel on the next one, retrying on its own only a few times */
+		SH1106_FlushState = SH1106_FLUSH_IDLE;
+		SH1106_FlushFailed = 1;
+		SH1106_FailTick = HAL_GetTick();
+		if (SH1106_FlushRetries < SH1106_FLUSH_RETRIES) {
+			SH1106_FlushRetries++;
+			SH1106_FlushRequested = 1;
+		}
+	}
+}
+
+/* Display bytes (commands, data and control bytes) sent over I2C in the last whole second */
+uint32_t SH1106_BytesPerSecond(void) {
+	/* Read only: the flush interrupt also updates the window */
+	if (HAL_GetTick() - SH1106_WindowStart >= 2000) {
+		return 0;
+	}
+	return SH1106_Rate;
+}
+
+/* Display bytes sent over I2C since power-up */
+uint32_t SH1106_TotalBytes(void) {
+	return SH1106_BytesSent;
+}
+
+static void SH1106_MarkDirty(uint8_t page, uint8_t x) {
+	if (x < SH1106_DirtyFirst[page]) {
+		SH1106_DirtyFirst[page] = x;
+	}
+	if (x > SH1106_DirtyLast[page]) {
+		SH1106_DirtyLast[page] = x;
+	}
+}
+
+static void SH1106_MarkAllDirty(void) {
+	for (uint8_t m = 0; m < SH1106_PAGES; m++) {
+		SH1106_DirtyFirst[m] = 0;
+		SH1106_DirtyLast[m] = SH1106_WIDTH - 1;
+	}
+}
+
+static void SH1106_CountBytes(uint16_t count) {
+	uint32_t now = HAL_GetTick();
+	
+	SH1106_BytesSent += count;
+	if (now - SH1106_WindowStart >= 1000) {
+		/* A gap of more than a second means nothing was sent in the last one */
+		SH1106_Rate = (now - SH1106_WindowStart >= 2000) ? 0 : SH1106_WindowBytes;
+		SH1106_WindowStart = now;
+		SH1106_WindowBytes = 0;
 	}
+	SH1106_WindowBytes += count;
 }
 
 void SH1106_ToggleInvert(void) {
@@ -131,11 +357,22 @@ void SH1106_ToggleInvert(void) {
 	for (i = 0; i < sizeof(SH1106_Buffer); i++) {
 		SH1106_Buffer[i] = ~SH1106_Buffer[i];
 	}
+	SH1106_MarkAllDirty();
 }
 
 void SH1106_Fill(SH1106_COLOR_t color) {
-	/* Set memory */
-	memset(SH1106_Buffer, (color == SH1106_COLOR_BLACK) ? 0x00 : 0xFF, sizeof(SH1106_Buffer));
+	uint8_t value = (color == SH1106_COLOR_BLACK) ? 0x00 : 0xFF;
+	
+	/* Set memory, marking the span of each page that changes */
+	for (uint8_t m = 0; m < SH1106_PAGES; m++) {
+		for (uint8_t x = 0; x < SH1106_WIDTH; x++) {
+			uint8_t* cell = &SH1106_Buffer[SH1106_WIDTH * m + x];
+			if (*cell != value) {
+				*cell = value;
+				SH1106_MarkDirty(m, x);
+			}
+		}
+	}
 }
 
 void SH1106_DrawPixel(uint16_t x, uint16_t y, SH1106_COLOR_t color) {
@@ -153,10 +390,19 @@ void SH1106_DrawPixel(uint16_t x, uint16_t y, SH1106_COLOR_t color) {
 	}
 	
 	/* Set color */
+	uint8_t page = y / 8;
+	uint8_t* cell = &SH1106_Buffer[x + page * SH1106_WIDTH];
+	uint8_t value;
 	if (color == SH1106_COLOR_WHITE) {
-		SH1106_Buffer[x + (y / 8) * SH1106_WIDTH] |= 1 << (y % 8);
+		value = *cell | (1 << (y % 8));
 	} else {
-		SH1106_Buffer[x + (y / 8) * SH1106_WIDTH] &= ~(1 << (y % 8));
+		value = *cell & ~(1 << (y % 8));
+	}
+	
+	/* Only a real change marks the column dirty, so redrawing what is already there sends nothing */
+	if (value != *cell) {
+		*cell = value;
+		SH1106_MarkDirty(page, x);
 	}
 }
 
@@ -166,8 +412,11 @@ void SH1106_GotoXY(uint16_t x, uint16_t y) {
 	SH1106.CurrentY = y;
 }
 
+/* Glyphs are drawn a column byte at a time, background included: whole bytes when CurrentY is a multiple of 8,
+   otherwise each glyph page is shifted across two screen pages under a mask */
 char SH1106_Putc(char ch, FontDef_t* Font, SH1106_COLOR_t color) {
-	uint32_t i, b, j;
+	uint8_t p, pages, shift, mask;
+	const uint8_t* glyph;
 	
 	/* Check available space in LCD */
 	if (
@@ -178,15 +427,21 @@ char SH1106_Putc(char ch, FontDef_t* Font, SH1106_COLOR_t color) {
 		return 0;
 	}
 	
+	/* Check if pixels are inverted */
+	if (SH1106.Inverted) {
+		color = (SH1106_COLOR_t)!color;
+	}
+	
 	/* Go through font */
-	for (i = 0; i < Font->FontHeight; i++) {
-		b = Font->data[(ch - 32) * Font->FontHeight + i];
-		for (j = 0; j < Font->FontWidth; j++) {
-			if ((b << j) & 0x8000) {
-				SH1106_DrawPixel(SH1106.CurrentX + j, (SH1106.CurrentY + i), (SH1106_COLOR_t) color);
-			} else {
-				SH1106_DrawPixel(SH1106.CurrentX + j, (SH1106.CurrentY + i), (SH1106_COLOR_t)!color);
-			}
+	pages = (Font->FontHeight + 7) / 8;
+	shift = SH1106.CurrentY % 8;
+	glyph = &Font->data[(ch - 32) * Font->FontWidth * pages];
+	for (p = 0; p < pages; p++) {
+		mask = (p == pages - 1 && (Font->FontHeight % 8)) ? (1 << (Font->FontHeight % 8)) - 1 : 0xFF;
+		
+		SH1106_Blit(SH1106.CurrentY / 8 + p, SH1106.CurrentX, &glyph[p * Font->FontWidth], Font->FontWidth, mask, shift, color, 1);
+		if (shift) {
+			SH1106_Blit(SH1106.CurrentY / 8 + p + 1, SH1106.CurrentX, &glyph[p * Font->FontWidth], Font->FontWidth, mask, shift - 8, color, 1);
 		}
 	}
 	
@@ -325,7 +580,7 @@ void SH1106_DrawRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, SH1106
 }
 
 void SH1106_DrawFilledRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, SH1106_COLOR_t c) {
-	uint8_t i;
+	uint8_t m, last, mask;
 	
 	/* Check input parameters */
 	if (
@@ -336,18 +591,30 @@ void SH1106_DrawFilledRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
 		return;
 	}
 	
-	/* Check width and height */
+	/* Check width and height; the rectangle covers x to x + w and y to y + h inclusive */
 	if ((x + w) >= SH1106_WIDTH) {
-		w = SH1106_WIDTH - x;
+		w = SH1106_WIDTH - 1 - x;
 	}
 	if ((y + h) >= SH1106_HEIGHT) {
-		h = SH1106_HEIGHT - y;
+		h = SH1106_HEIGHT - 1 - y;
 	}
 	
-	/* Draw lines */
-	for (i = 0; i <= h; i++) {
-		/* Draw lines */
-		SH1106_DrawLine(x, y + i, x + w, y + i, c);
+	/* Check if pixels are inverted */
+	if (SH1106.Inverted) {
+		c = (SH1106_COLOR_t)!c;
+	}
+	
+	/* Fill page by page, masking the rows outside the rectangle in the first and last page */
+	last = (y + h) / 8;
+	for (m = y / 8; m <= last; m++) {
+		mask = 0xFF;
+		if (m == y / 8) {
+			mask &= 0xFF << (y % 8);
+		}
+		if (m == last) {
+			mask &= 0xFF >> (7 - (y + h) % 8);
+		}
+		SH1106_FillColumns(m, x, w + 1, mask, c);
 	}
 }
 
@@ -498,21 +765,21 @@ void SH1106_OFF(void) {
 	SH1106_WRITECOMMAND(0xAE);
 }
 
+/* The control byte goes out as the memory address of a memory write, so data is sent in place */
 void SH1106_I2C_WriteMulti(uint8_t address, uint8_t reg, uint8_t* data, uint16_t count) {
-uint8_t dt[256];
-dt[0] = reg;
-uint8_t i;
-for(i = 0; i < count; i++)
-dt[i+1] = data[i];
-HAL_I2C_Master_Transmit(SH1106_I2C, address, dt, count+1, 10);
+	SH1106_WaitFlush();
+	HAL_I2C_Mem_Write(SH1106_I2C, address, reg, I2C_MEMADD_SIZE_8BIT, data, count, 10);
+	SH1106_CountBytes(count + 1);
 }
 
 
 void SH1106_I2C_Write(uint8_t address, uint8_t reg, uint8_t data) {
 	uint8_t dt[2];
+	SH1106_WaitFlush();
 	dt[0] = reg;
 	dt[1] = data;
 	HAL_I2C_Master_Transmit(SH1106_I2C, address, dt, 2, 10);
+	SH1106_CountBytes(2);
 }
 
 void SH1106_InvertDisplay (int i)
@@ -546,3 +813,101 @@ void SH1106_DrawBitmap(int16_t x, int16_t y, const unsigned char* bitmap, int16_
         }
     }
 }
+
+void SH1106_DrawSprite(uint16_t x, uint16_t y, const uint8_t* sprite, uint16_t w, uint16_t h, SH1106_COLOR_t color) {
+	uint8_t p, pages, shift, count, mask;
+	
+	/* Check input parameters */
+	if (
+		x >= SH1106_WIDTH ||
+		y >= SH1106_HEIGHT ||
+		w == 0 ||
+		h == 0
+	) {
+		/* Error */
+		return;
+	}
+	
+	/* Check if pixels are inverted */
+	if (SH1106.Inverted) {
+		color = (SH1106_COLOR_t)!color;
+	}
+	
+	/* Clip on the right; rows below the screen fall off the last page */
+	count = (x + w > SH1106_WIDTH) ? SH1106_WIDTH - x : w;
+	pages = (h + 7) / 8;
+	shift = y % 8;
+	
+	for (p = 0; p < pages; p++) {
+		/* Rows past h in the last sprite page are not drawn */
+		mask = (p == pages - 1 && (h % 8)) ? (1 << (h % 8)) - 1 : 0xFF;
+		
+		/* Each sprite page lands on one screen page, or straddles two when y is not a multiple of 8 */
+		SH1106_Blit(y / 8 + p, x, &sprite[p * w], count, mask, shift, color, 0);
+		if (shift) {
+			SH1106_Blit(y / 8 + p + 1, x, &sprite[p * w], count, mask, shift - 8, color, 0);
+		}
+	}
+}
+
+/* Draws count column bytes into one page, shifted down by shift rows (up when negative).  Set bits are drawn
+   in color; clear bits are left alone, or drawn in the other color when opaque */
+static void SH1106_Blit(uint8_t page, uint8_t x, const uint8_t* src, uint8_t count, uint8_t mask, int8_t shift, SH1106_COLOR_t color, uint8_t opaque) {
+	uint8_t i, bits, value, area, invert;
+	uint8_t first = SH1106_WIDTH, last = 0;
+	uint8_t* cell;
+	
+	/* Rows of this page the source covers */
+	area = (shift >= 0) ? (uint8_t)(mask << shift) : (uint8_t)(mask >> -shift);
+	if (page >= SH1106_PAGES || area == 0) {
+		return;
+	}
+	cell = &SH1106_Buffer[SH1106_WIDTH * page + x];
+	invert = (color == SH1106_COLOR_WHITE) ? 0x00 : 0xFF;
+	
+	for (i = 0; i < count; i++) {
+		bits = (shift >= 0) ? (uint8_t)(src[i] << shift) : (uint8_t)(src[i] >> -shift);
+		bits &= area;
+		if (opaque) {
+			value = (cell[i] & ~area) | ((bits ^ invert) & area);
+		} else {
+			value = invert ? (cell[i] & ~bits) : (cell[i] | bits);
+		}
+		if (value != cell[i]) {
+			cell[i] = value;
+			if (first == SH1106_WIDTH) {
+				first = i;
+			}
+			last = i;
+		}
+	}
+	
+	/* One dirty mark for the span that changed */
+	if (first <= last) {
+		SH1106_MarkDirty(page, x + first);
+		SH1106_MarkDirty(page, x + last);
+	}
+}
+
+/* Sets (or clears) the mask rows of count columns of one page */
+static void SH1106_FillColumns(uint8_t page, uint8_t x, uint8_t count, uint8_t mask, SH1106_COLOR_t color) {
+	uint8_t i, value;
+	uint8_t first = SH1106_WIDTH, last = 0;
+	uint8_t* cell = &SH1106_Buffer[SH1106_WIDTH * page + x];
+	
+	for (i = 0; i < count; i++) {
+		value = (color == SH1106_COLOR_WHITE) ? (cell[i] | mask) : (cell[i] & ~mask);
+		if (value != cell[i]) {
+			cell[i] = value;
+			if (first == SH1106_WIDTH) {
+				first = i;
+			}
+			last = i;
+		}
+	}
+	
+	if (first <= last) {
+		SH1106_MarkDirty(page, x + first);
+		SH1106_MarkDirty(page, x + last);
+	}
+}
@@ -0,0 +1,151 @@
+/*
+ * blep.h
+ *
+ *  Created on: 10/18/2026
+ *
+ */
+
+#ifndef BLEP_H_
+#define BLEP_H_
+
+// Band-limited edge corrections for synthSquareBlep() and synthRampBlamp().  The kernel is a sinc cut off at
+// 0.9 x Nyquist under a Blackman window spanning 8 samples.  For an edge p / 64 of a sample after sample n, row p
+// holds the corrections for samples n - 3 to n + 4.  Q15.
+
+// Integrated kernel minus the ideal step, in units of the step height
+const int16_t BLEP_residual[SYNTH_BLEP_PHASES][SYNTH_BLEP_TAPS] = {
+		{     18,    201,  -1815, -16384,   1815,   -201,    -18,      0 },
+		{     15,    217,  -1851,  15923,   1773,   -184,    -21,      0 },
+		{     13,    231,  -1881,  15463,   1725,   -166,    -24,      0 },
+		{     10,    244,  -1905,  15003,   1670,   -146,    -28,      0 },
+		{      8,    255,  -1924,  14545,   1608,   -124,    -32,      0 },
+		{      6,    266,  -1937,  14088,   1539,   -102,    -35,      0 },
+		{      4,    275,  -1945,  13632,   1463,    -77,    -40,      0 },
+		{      3,    282,  -1948,  13179,   1379,    -51,    -44,      0 },
+		{      1,    289,  -1946,  12728,   1288,    -24,    -49,      0 },
+		{      0,    295,  -1939,  12280,   1190,      5,    -54,      0 },
+		{     -2,    299,  -1929,  11835,   1083,     36,    -59,      0 },
+		{     -3,    302,  -1914,  11394,    969,     68,    -64,      0 },
+		{     -3,    305,  -1895,  10956,    846,    101,    -70,      0 },
+		{     -4,    306,  -1873,  10523,    715,    136,    -75,      0 },
+		{     -5,    307,  -1848,  10094,    576,    173,    -81,      1 },
+		{     -6,    307,  -1819,   9670,    429,    211,    -88,      1 },
+		{     -6,    306,  -1787,   9250,    272,    251,    -94,      1 },
+		{     -6,    304,  -1752,   8836,    107,    291,   -101,      1 },
+		{     -7,    302,  -1715,   8428,    -66,    334,   -108,      1 },
+		{     -7,    298,  -1675,   8025,   -248,    377,   -115,      1 },
+		{     -7,    295,  -1634,   7629,   -440,    422,   -122,      1 },
+		{     -7,    290,  -1590,   7239,   -640,    468,   -130,      2 },
+		{     -7,    285,  -1544,   6856,   -849,    515,   -137,      2 },
+		{     -7,    280,  -1497,   6479,  -1067,    563,   -145,      2 },
+		{     -7,    274,  -1449,   6110,  -1294,    612,   -153,      2 },
+		{     -7,    268,  -1399,   5747,  -1530,    663,   -161,      3 },
+		{     -6,    262,  -1348,   5393,  -1775,    713,   -169,      3 },
+		{     -6,    255,  -1296,   5046,  -2029,    765,   -177,      3 },
+		{     -6,    248,  -1244,   4706,  -2292,    817,   -185,      4 },
+		{     -6,    240,  -1191,   4375,  -2564,    870,   -193,      4 },
+		{     -5,    233,  -1138,   4052,  -2844,    923,   -201,      4 },
+		{     -5,    225,  -1084,   3737,  -3133,    977,   -209,      4 },
+		{     -5,    217,  -1031,   3431,  -3431,   1031,   -217,      5 },
+		{     -4,    209,   -977,   3133,  -3737,   1084,   -225,      5 },
+		{     -4,    201,   -923,   2844,  -4052,   1138,   -233,      5 },
+		{     -4,    193,   -870,   2564,  -4375,   1191,   -240,      6 },
+		{     -4,    185,   -817,   2292,  -4706,   1244,   -248,      6 },
+		{     -3,    177,   -765,   2029,  -5046,   1296,   -255,      6 },
+		{     -3,    169,   -713,   1775,  -5393,   1348,   -262,      6 },
+		{     -3,    161,   -663,   1530,  -5747,   1399,   -268,      7 },
+		{     -2,    153,   -612,   1294,  -6110,   1449,   -274,      7 },
+		{     -2,    145,   -563,   1067,  -6479,   1497,   -280,      7 },
+		{     -2,    137,   -515,    849,  -6856,   1544,   -285,      7 },
+		{     -2,    130,   -468,    640,  -7239,   1590,   -290,      7 },
+		{     -1,    122,   -422,    440,  -7629,   1634,   -295,      7 },
+		{     -1,    115,   -377,    248,  -8025,   1675,   -298,      7 },
+		{     -1,    108,   -334,     66,  -8428,   1715,   -302,      7 },
+		{     -1,    101,   -291,   -107,  -8836,   1752,   -304,      6 },
+		{     -1,     94,   -251,   -272,  -9250,   1787,   -306,      6 },
+		{     -1,     88,   -211,   -429,  -9670,   1819,   -307,      6 },
+		{     -1,     81,   -173,   -576, -10094,   1848,   -307,      5 },
+		{      0,     75,   -136,   -715, -10523,   1873,   -306,      4 },
+		{      0,     70,   -101,   -846, -10956,   1895,   -305,      3 },
+		{      0,     64,    -68,   -969, -11394,   1914,   -302,      3 },
+		{      0,     59,    -36,  -1083, -11835,   1929,   -299,      2 },
+		{      0,     54,     -5,  -1190, -12280,   1939,   -295,      0 },
+		{      0,     49,     24,  -1288, -12728,   1946,   -289,     -1 },
+		{      0,     44,     51,  -1379, -13179,   1948,   -282,     -3 },
+		{      0,     40,     77,  -1463, -13632,   1945,   -275,     -4 },
+		{      0,     35,    102,  -1539, -14088,   1937,   -266,     -6 },
+		{      0,     32,    124,  -1608, -14545,   1924,   -255,     -8 },
+		{      0,     28,    146,  -1670, -15003,   1905,   -244,    -10 },
+		{      0,     24,    166,  -1725, -15463,   1881,   -231,    -13 },
+		{      0,     21,    184,  -1773, -15923,   1851,   -217,    -15 }
+};
+
+// Twice-integrated kernel minus the ideal corner, in samples per unit change of slope
+const int16_t BLAMP_residual[SYNTH_BLEP_PHASES][SYNTH_BLEP_TAPS] = {
+		{     -2,    186,   -800,   3981,   -800,    186,     -2,      0 },
+		{     -2,    183,   -772,   3729,   -828,    189,     -1,      0 },
+		{     -2,    180,   -743,   3484,   -856,    192,     -1,      0 },
+		{     -2,    176,   -713,   3246,   -882,    195,     -1,      0 },
+		{     -2,    172,   -683,   3015,   -908,    197,      0,      0 },
+		{     -2,    168,   -653,   2791,   -933,    198,      0,      0 },
+		{     -3,    164,   -623,   2575,   -956,    200,      1,      0 },
+		{     -3,    159,   -592,   2365,   -978,    201,      2,      0 },
+		{     -3,    155,   -562,   2163,   -999,    201,      2,      0 },
+		{     -3,    150,   -531,   1968,  -1018,    202,      3,      0 },
+		{     -3,    146,   -501,   1779,  -1036,    201,      4,      0 },
+		{     -3,    141,   -471,   1598,  -1052,    201,      5,      0 },
+		{     -3,    136,   -441,   1423,  -1066,    199,      6,      0 },
+		{     -3,    132,   -412,   1255,  -1079,    197,      7,      0 },
+		{     -2,    127,   -383,   1094,  -1089,    195,      8,      0 },
+		{     -2,    122,   -354,    940,  -1097,    192,     10,      0 },
+		{     -2,    117,   -326,    792,  -1102,    188,     11,      0 },
+		{     -2,    112,   -298,    651,  -1105,    184,     13,      0 },
+		{     -2,    108,   -271,    516,  -1105,    179,     14,      0 },
+		{     -2,    103,   -245,    387,  -1103,    174,     16,      0 },
+		{     -2,     98,   -219,    265,  -1098,    167,     18,      0 },
+		{     -2,     94,   -194,    149,  -1089,    160,     20,      0 },
+		{     -2,     89,   -169,     39,  -1078,    153,     22,      0 },
+		{     -2,     85,   -146,    -65,  -1063,    144,     24,      0 },
+		{     -1,     81,   -122,   -164,  -1044,    135,     27,      0 },
+		{     -1,     76,   -100,   -256,  -1022,    125,     29,      0 },
+		{     -1,     72,    -79,   -343,   -996,    114,     32,      0 },
+		{     -1,     68,    -58,   -425,   -967,    103,     34,      0 },
+		{     -1,     64,    -38,   -501,   -933,     91,     37,      0 },
+		{     -1,     60,    -19,   -572,   -895,     77,     40,      0 },
+		{     -1,     57,     -1,   -638,   -853,     63,     43,     -1 },
+		{     -1,     53,     16,   -699,   -806,     49,     46,     -1 },
+		{     -1,     50,     33,   -755,   -755,     33,     50,     -1 },
+		{     -1,     46,     49,   -806,   -699,     16,     53,     -1 },
+		{     -1,     43,     63,   -853,   -638,     -1,     57,     -1 },
+		{      0,     40,     77,   -895,   -572,    -19,     60,     -1 },
+		{      0,     37,     91,   -933,   -501,    -38,     64,     -1 },
+		{      0,     34,    103,   -967,   -425,    -58,     68,     -1 },
+		{      0,     32,    114,   -996,   -343,    -79,     72,     -1 },
+		{      0,     29,    125,  -1022,   -256,   -100,     76,     -1 },
+		{      0,     27,    135,  -1044,   -164,   -122,     81,     -1 },
+		{      0,     24,    144,  -1063,    -65,   -146,     85,     -2 },
+		{      0,     22,    153,  -1078,     39,   -169,     89,     -2 },
+		{      0,     20,    160,  -1089,    149,   -194,     94,     -2 },
+		{      0,     18,    167,  -1098,    265,   -219,     98,     -2 },
+		{      0,     16,    174,  -1103,    387,   -245,    103,     -2 },
+		{      0,     14,    179,  -1105,    516,   -271,    108,     -2 },
+		{      0,     13,    184,  -1105,    651,   -298,    112,     -2 },
+		{      0,     11,    188,  -1102,    792,   -326,    117,     -2 },
+		{      0,     10,    192,  -1097,    940,   -354,    122,     -2 },
+		{      0,      8,    195,  -1089,   1094,   -383,    127,     -2 },
+		{      0,      7,    197,  -1079,   1255,   -412,    132,     -3 },
+		{      0,      6,    199,  -1066,   1423,   -441,    136,     -3 },
+		{      0,      5,    201,  -1052,   1598,   -471,    141,     -3 },
+		{      0,      4,    201,  -1036,   1779,   -501,    146,     -3 },
+		{      0,      3,    202,  -1018,   1968,   -531,    150,     -3 },
+		{      0,      2,    201,   -999,   2163,   -562,    155,     -3 },
+		{      0,      2,    201,   -978,   2365,   -592,    159,     -3 },
+		{      0,      1,    200,   -956,   2575,   -623,    164,     -3 },
+		{      0,      0,    198,   -933,   2791,   -653,    168,     -2 },
+		{      0,      0,    197,   -908,   3015,   -683,    172,     -2 },
+		{      0,     -1,    195,   -882,   3246,   -713,    176,     -2 },
+		{      0,     -1,    192,   -856,   3484,   -743,    180,     -2 },
+		{      0,     -1,    189,   -828,   3729,   -772,    183,     -2 }
+};
+
+#endif
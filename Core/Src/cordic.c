@@ -0,0 +1,96 @@
+/*
+ * cordic.c
+ *
+ *  Created on: 10/18/2026
+ */
+
+// Angles are Q1.31 fractions of pi (0x80000000 = -pi), which is a 32-bit DDS phase reinterpreted as signed.
+// Results are Q1.31.  Either output pointer may be NULL when only one of them is wanted.
+
+#include "cordic.h"
+
+#if CORDIC_HW
+#include "stm32h7xx_hal.h"
+
+// Cosine function, 24 iterations, no scaling, one 32-bit argument in, two 32-bit results out
+#define CORDIC_CSR_SINCOS	((6UL << CORDIC_CSR_PRECISION_Pos) | CORDIC_CSR_NRES)
+#endif
+
+#define CORDIC_GAIN_INV		1304065748L			// 1 / prod(sqrt(1 + 2^-2i)), i = 0..23, Q1.31
+
+// atan(2^-i) / pi, Q1.31
+static const int32_t CORDIC_ATAN[CORDIC_ITERATIONS] = {
+	536870912, 316933406, 167458907, 85004756, 42667331, 21354465, 10679838, 5340245,
+	2670163, 1335087, 667544, 333772, 166886, 83443, 41722, 20861,
+	10430, 5215, 2608, 1304, 652, 326, 163, 81
+};
+
+void cordicInit(void){
+#if CORDIC_HW
+	__HAL_RCC_CORDIC_CLK_ENABLE();
+	CORDIC->CSR = CORDIC_CSR_SINCOS;
+#endif
+}
+
+void cordicSinCos(const int32_t * angle, int32_t * sine, int32_t * cosine, uint16_t count){
+#if CORDIC_HW
+	int32_t c, s;
+	for(uint16_t i = 0; i < count; i++){
+		CORDIC->WDATA = (uint32_t)angle[i];
+		c = (int32_t)CORDIC->RDATA;						// Stalls until the calculation is done
+		s = (int32_t)CORDIC->RDATA;
+		if(cosine){
+			cosine[i] = c;
+		}
+		if(sine){
+			sine[i] = s;
+		}
+	}
+#else
+	cordicSinCosSoft(angle, sine, cosine, count);
+#endif
+}
+
+// Rotation-mode CORDIC.  The 2nd and 3rd quadrants are rotated by pi first, since the iterations only converge
+// for |angle| <= ~0.55 pi, and the results are negated to match
+void cordicSinCosSoft(const int32_t * angle, int32_t * sine, int32_t * cosine, uint16_t count){
+	for(uint16_t n = 0; n < count; n++){
+		int32_t z			= angle[n];
+		int64_t x			= CORDIC_GAIN_INV;
+		int64_t y			= 0;
+		int64_t t;
+		uint8_t flip		= 0;
+
+		if((z ^ (int32_t)((uint32_t)z << 1)) < 0){
+			z = (int32_t)((uint32_t)z + 0x80000000UL);
+			flip = 1;
+		}
+
+		for(uint8_t i = 0; i < CORDIC_ITERATIONS; i++){
+			t = x;
+			if(z >= 0){
+				x -= y >> i;
+				y += t >> i;
+				z -= CORDIC_ATAN[i];
+			}else{
+				x += y >> i;
+				y -= t >> i;
+				z += CORDIC_ATAN[i];
+			}
+		}
+
+		if(flip){
+			x = -x;
+			y = -y;
+		}
+		// Rounding can land just outside -1.0..+1.0, and +1.0 itself is not representable in Q1.31
+		x = (x > INT32_MAX ? INT32_MAX : (x < INT32_MIN ? INT32_MIN : x));
+		y = (y > INT32_MAX ? INT32_MAX : (y < INT32_MIN ? INT32_MIN : y));
+		if(cosine){
+			cosine[n] = (int32_t)x;
+		}
+		if(sine){
+			sine[n] = (int32_t)y;
+		}
+	}
+}
@@ -0,0 +1,109 @@
+/*
+ * dds.c
+ *
+ *  Created on: 10/18/2026
+ */
+
+#include "dds.h"
+
+#define DDS_PHASE_STEPS		4294967296ULL		// 2^32, one full output cycle
+#define DDS_SAMPLE_RATE_MHZ	((uint64_t)DDS_SAMPLE_RATE_HZ * 1000)	// Sample rate in millihertz
+
+DDS_HandleTypeDef dds_create(const uint16_t * table){
+
+	DDS_HandleTypeDef dds;
+
+	dds.phase			= 0;
+	dds.tuningWord		= 0;
+	dds.waveform		= DDS_WAVE_SINE;
+	dds.table			= table;
+	dds.arbTable		= table;
+	dds.arbSize			= DDS_TABLE_SIZE;
+	ddsSetDuty(&dds, 500);
+
+	return dds;
+}
+
+// Phase step for an output frequency in millihertz, rounded to the nearest count
+uint32_t ddsTuningWord(uint32_t milliHz){
+	return (uint32_t)((((uint64_t)milliHz << 32) + DDS_SAMPLE_RATE_MHZ / 2) / DDS_SAMPLE_RATE_MHZ);
+}
+
+// Frequency actually produced by a tuning word, in millihertz.  Resolution is fs / 2^32 (~0.64 mHz)
+uint32_t ddsActualMilliHz(uint32_t tuningWord){
+	return (uint32_t)(((uint64_t)tuningWord * DDS_SAMPLE_RATE_MHZ + DDS_PHASE_STEPS / 2) >> 32);
+}
+
+// Signed error of a tuning word against the frequency it was asked for, parts per billion.  Rounding the
+// tuning word costs at most fs / 2^33 (~0.32 mHz), i.e. under 1 ppm for anything above 320 Hz
+int32_t ddsErrorPpb(uint32_t milliHz, uint32_t tuningWord){
+	if(milliHz == 0){
+		return 0;
+	}
+	uint64_t produced	= (uint64_t)tuningWord * DDS_SAMPLE_RATE_MHZ;		// Both sides scaled by 2^32
+	uint64_t wanted		= (uint64_t)milliHz << 32;
+	if(produced >= wanted){
+		return (int32_t)((produced - wanted) * 1000000000ULL / wanted);
+	}
+	return -(int32_t)((wanted - produced) * 1000000000ULL / wanted);
+}
+
+// Writes the next 'count' samples into buf.  The accumulator is never reset, so consecutive calls
+// (and any frequency or duty change between them) continue the waveform without a phase jump
+void ddsFill(DDS_HandleTypeDef * dds, uint16_t * buf, uint16_t count){
+	uint32_t phase	= dds->phase;
+	uint32_t step	= dds->tuningWord;
+	uint16_t i;
+
+	switch(dds->waveform){
+	case DDS_WAVE_SQUARE:
+		for(i = 0; i < count; i++){
+			buf[i] = (phase < dds->dutyPhase ? DDS_FULL_SCALE : 0);
+			phase += step;
+		}
+		break;
+
+	case DDS_WAVE_RAMP:
+		for(i = 0; i < count; i++){
+			if(phase < dds->dutyPhase){
+				buf[i] = (uint16_t)((phase * dds->riseGain) >> 48);
+			}else{
+				buf[i] = (uint16_t)(((uint32_t)(0 - phase) * dds->fallGain) >> 48);
+			}
+			phase += step;
+		}
+		break;
+
+	case DDS_WAVE_ARB:
+		for(i = 0; i < count; i++){
+			buf[i] = dds->arbTable[((uint64_t)phase * dds->arbSize) >> 32];
+			phase += step;
+		}
+		break;
+
+	default:
+		for(i = 0; i < count; i++){
+			buf[i] = dds->table[((uint64_t)phase * DDS_TABLE_SIZE) >> 32];
+			phase += step;
+		}
+	}
+	dds->phase = phase;
+}
+
+// Copies everything except the phase accumulator, so the output carries on from where it is
+void ddsLoadSettings(DDS_HandleTypeDef * dds, const DDS_HandleTypeDef * next){
+	uint32_t phase = dds->phase;
+	*dds = *next;
+	dds->phase = phase;
+}
+
+void ddsSetFrequency(DDS_HandleTypeDef * dds, uint32_t milliHz){
+	dds->tuningWord = ddsTuningWord(milliHz);
+}
+
+// Duty cycle (square) or symmetry (ramp) in 0.1% steps, 10 to 990
+void ddsSetDuty(DDS_HandleTypeDef * dds, uint16_t tenths){
+	dds->dutyPhase	= (uint32_t)(DDS_PHASE_STEPS * tenths / 1000);
+	dds->riseGain	= ((uint64_t)DDS_FULL_SCALE << 48) / dds->dutyPhase;
+	dds->fallGain	= ((uint64_t)DDS_FULL_SCALE << 48) / (DDS_PHASE_STEPS - dds->dutyPhase);
+}
@@ -0,0 +1,36 @@
+/*
+ * dmabuf.c
+ *
+ *  Created on: 10/18/2026
+ */
+
+#include "stm32h7xx_hal.h"
+#include "dmabuf.h"
+
+// Push CPU writes in [addr, addr + bytes) out of the D-cache so DMA reads them.  A no-op while the D-cache is
+// off, so callers clean unconditionally after every write to a DMA_BUFFER.
+void dmaBufferClean(const void * addr, uint32_t bytes){
+
+	if(bytes == 0 || !(SCB->CCR & SCB_CCR_DC_Msk)){
+		return;
+	}
+
+	uint32_t start	= (uint32_t)addr & ~(uint32_t)(DMA_CACHE_LINE - 1);
+	uint32_t end	= (uint32_t)addr + bytes;
+
+	SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+}
+
+// Drops [addr, addr + bytes) from the D-cache so the next CPU read fetches what DMA wrote.  Lines are cleaned as
+// they are dropped, so CPU data sharing a partial line at either end is kept
+void dmaBufferInvalidate(void * addr, uint32_t bytes){
+
+	if(bytes == 0 || !(SCB->CCR & SCB_CCR_DC_Msk)){
+		return;
+	}
+
+	uint32_t start	= (uint32_t)addr & ~(uint32_t)(DMA_CACHE_LINE - 1);
+	uint32_t end	= (uint32_t)addr + bytes;
+
+	SCB_CleanInvalidateDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+}
@@ -0,0 +1,168 @@
+/*
+ * mdmafill.c
+ *
+ *  Created on: 10/18/2026
+ */
+
+#include <stddef.h>
+#include "mdmafill.h"
+#include "dmabuf.h"
+
+#define MDMA_FILL_MAX_BLOCKS		4096		// Repeat count limit, one block per sample when striding
+
+static DMA_BUFFER uint16_t constants[2];		// Fill values for mdmaFillSquare(), read by the MDMA
+static DMA_BUFFER MDMA_LinkNodeTypeDef lowNode;	// Second half of a square cycle
+static MdmaFill_HandleTypeDef * active;			// Handle the MDMA interrupt reports to
+
+static void configure(MdmaFill_HandleTypeDef * fill, uint32_t sourceInc, uint32_t transferLength, int32_t sourceOffset);
+static uint8_t begin(MdmaFill_HandleTypeDef * fill, uint16_t * dst, uint16_t count);
+static MdmaFill_HandleTypeDef * owner(MDMA_HandleTypeDef * hmdma);
+static void transferComplete(MDMA_HandleTypeDef * hmdma);
+static void transferError(MDMA_HandleTypeDef * hmdma);
+
+MdmaFill_HandleTypeDef mdmaFill_create(MDMA_Channel_TypeDef * channel){
+
+	MdmaFill_HandleTypeDef fill = {0};
+
+	fill.hmdma.Instance	= channel;
+	fill.busy			= 0;
+	fill.failed			= 0;
+	fill.dst			= NULL;
+	fill.count			= 0;
+
+	return fill;
+}
+
+// Enables the MDMA clock and interrupt.  The handle must stay at the same address from here on
+void mdmaFillInit(MdmaFill_HandleTypeDef * fill){
+	active = fill;
+	__HAL_RCC_MDMA_CLK_ENABLE();
+	HAL_NVIC_SetPriority(MDMA_IRQn, MDMA_FILL_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(MDMA_IRQn);
+}
+
+// Copies count samples from src to dst, taking every stride-th sample.  Returns 0, with nothing started, if the
+// channel is busy or the transfer is out of the MDMA's range
+uint8_t mdmaFillCopy(MdmaFill_HandleTypeDef * fill, uint16_t * dst, const uint16_t * src, uint16_t count,
+		uint16_t stride){
+	if(stride == 0 || (stride > 1 && count > MDMA_FILL_MAX_BLOCKS) || !begin(fill, dst, count)){
+		return 0;
+	}
+	dmaBufferClean(src, ((uint32_t)(count - 1) * stride + 1) * sizeof(uint16_t));
+
+	if(stride == 1){
+		// One block, moved 128 bytes per buffer transfer
+		configure(fill, MDMA_SRC_INC_HALFWORD, 128, 0);
+		HAL_MDMA_Init(&fill->hmdma);
+		HAL_MDMA_Start_IT(&fill->hmdma, (uint32_t)src, (uint32_t)dst, count * sizeof(uint16_t), 1);
+	}else{
+		// One sample per block, the source skipping stride - 1 samples between blocks
+		configure(fill, MDMA_SRC_INC_HALFWORD, sizeof(uint16_t), (stride - 1) * sizeof(uint16_t));
+		HAL_MDMA_Init(&fill->hmdma);
+		HAL_MDMA_Start_IT(&fill->hmdma, (uint32_t)src, (uint32_t)dst, sizeof(uint16_t), count);
+	}
+	return 1;
+}
+
+// Writes high to dst[0..highCount - 1] and low to the rest of the count samples, as one linked-list request.
+// Returns 0, with nothing started, if the channel is busy
+uint8_t mdmaFillSquare(MdmaFill_HandleTypeDef * fill, uint16_t * dst, uint16_t count, uint16_t highCount,
+		uint16_t high, uint16_t low){
+	if(highCount > count || !begin(fill, dst, count)){
+		return 0;
+	}
+	constants[0] = high;
+	constants[1] = low;
+	dmaBufferClean(constants, sizeof(constants));
+
+	configure(fill, MDMA_SRC_INC_DISABLE, 128, 0);
+	HAL_MDMA_Init(&fill->hmdma);
+	if(highCount == 0 || highCount == count){
+		HAL_MDMA_Start_IT(&fill->hmdma, (uint32_t)&constants[highCount == 0], (uint32_t)dst,
+				count * sizeof(uint16_t), 1);
+		return 1;
+	}
+
+	MDMA_LinkNodeConfTypeDef node;
+	node.Init					= fill->hmdma.Init;
+	node.SrcAddress				= (uint32_t)&constants[1];
+	node.DstAddress				= (uint32_t)&dst[highCount];
+	node.BlockDataLength		= (count - highCount) * sizeof(uint16_t);
+	node.BlockCount				= 1;
+	node.PostRequestMaskAddress	= 0;
+	node.PostRequestMaskData	= 0;
+	HAL_MDMA_LinkedList_CreateNode(&lowNode, &node);
+	HAL_MDMA_LinkedList_AddNode(&fill->hmdma, &lowNode, NULL);
+	dmaBufferClean(&lowNode, sizeof(lowNode));
+
+	HAL_MDMA_Start_IT(&fill->hmdma, (uint32_t)&constants[0], (uint32_t)dst, highCount * sizeof(uint16_t), 1);
+	return 1;
+}
+
+// Returns 1 once the last transfer has finished (or failed, see fill->failed) and its destination is safe for the
+// CPU to read, 0 while it is still running
+uint8_t mdmaFillDone(MdmaFill_HandleTypeDef * fill){
+	if(fill->busy){
+		return 0;
+	}
+	if(fill->dst != NULL){
+		dmaBufferInvalidate(fill->dst, fill->count * sizeof(uint16_t));
+		fill->dst = NULL;
+	}
+	return 1;
+}
+
+void mdmaFillIRQHandler(void){
+	if(active != NULL){
+		HAL_MDMA_IRQHandler(&active->hmdma);
+	}
+}
+
+static void configure(MdmaFill_HandleTypeDef * fill, uint32_t sourceInc, uint32_t transferLength, int32_t sourceOffset){
+	MDMA_InitTypeDef * init = &fill->hmdma.Init;
+	init->Request					= MDMA_REQUEST_SW;
+	init->TransferTriggerMode		= MDMA_FULL_TRANSFER;
+	init->Priority					= MDMA_PRIORITY_LOW;
+	init->Endianness				= MDMA_LITTLE_ENDIANNESS_PRESERVE;
+	init->SourceInc					= sourceInc;
+	init->DestinationInc			= MDMA_DEST_INC_HALFWORD;
+	init->SourceDataSize			= MDMA_SRC_DATASIZE_HALFWORD;
+	init->DestDataSize				= MDMA_DEST_DATASIZE_HALFWORD;
+	init->DataAlignment				= MDMA_DATAALIGN_PACKENABLE;
+	init->BufferTransferLength		= transferLength;
+	init->SourceBurst				= MDMA_SOURCE_BURST_SINGLE;
+	init->DestBurst					= MDMA_DEST_BURST_SINGLE;
+	init->SourceBlockAddressOffset	= sourceOffset;
+	init->DestBlockAddressOffset	= 0;
+}
+
+// Claims the channel for a transfer into dst.  The destination is cleaned and dropped from the D-cache first, so
+// no dirty line can later be written back over what the MDMA wrote
+static uint8_t begin(MdmaFill_HandleTypeDef * fill, uint16_t * dst, uint16_t count){
+	if(fill->busy || count == 0 || !mdmaFillDone(fill)){
+		return 0;
+	}
+	dmaBufferInvalidate(dst, count * sizeof(uint16_t));
+	fill->dst						= dst;
+	fill->count						= count;
+	fill->failed					= 0;
+	fill->busy						= 1;
+	fill->hmdma.XferCpltCallback	= transferComplete;
+	fill->hmdma.XferErrorCallback	= transferError;
+	return 1;
+}
+
+// The fill handle that owns hmdma, so the callbacks report to the transfer that raised them
+static MdmaFill_HandleTypeDef * owner(MDMA_HandleTypeDef * hmdma){
+	return (MdmaFill_HandleTypeDef *)((uint8_t *)hmdma - offsetof(MdmaFill_HandleTypeDef, hmdma));
+}
+
+static void transferComplete(MDMA_HandleTypeDef * hmdma){
+	owner(hmdma)->busy = 0;
+}
+
+static void transferError(MDMA_HandleTypeDef * hmdma){
+	MdmaFill_HandleTypeDef * fill = owner(hmdma);
+	fill->failed	= 1;
+	fill->busy		= 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * modulate.c
+ *
+ *  Created on: 10/18/2026
+ */
+
+#include "modulate.h"
+
+static int32_t modLfo(const Mod_HandleTypeDef * mod);
+
+Mod_HandleTypeDef mod_create(const uint16_t * table){
+
+	Mod_HandleTypeDef mod;
+
+	mod.lfoPhase		= 0;
+	mod.lfoStep			= 0;
+	mod.depth			= 0;
+	mod.phaseOffset		= 0;
+	mod.type			= MOD_TYPE_AM;
+	mod.shape			= MOD_SHAPE_SINE;
+	mod.table			= table;
+	mod.active			= 0;
+
+	return mod;
+}
+
+// Sets the modulation type, LFO shape, LFO phase step per block and depth (units in Mod_HandleTypeDef).  Does not
+// start it; set mod->active once the caller is ready.  Returns 0 for an unknown type or shape
+uint8_t modConfigure(Mod_HandleTypeDef * mod, uint8_t type, uint8_t shape, uint32_t lfoStep, int32_t depth){
+	if(type > MOD_TYPE_PM || shape > MOD_SHAPE_RAMP){
+		return 0;
+	}
+	mod->active		= 0;
+	mod->type		= type;
+	mod->shape		= shape;
+	mod->lfoStep	= lfoStep;
+	mod->depth		= depth;
+	mod->lfoPhase	= 0;
+	return 1;
+}
+
+// Advances the LFO one block and applies FM or PM to dds for it.  The tuning word is set from carrierWord every
+// block, so the caller restores it after the last one.  Returns the LFO value for modLevel()
+int32_t modStep(Mod_HandleTypeDef * mod, DDS_HandleTypeDef * dds, uint32_t carrierWord){
+	int32_t lfo = modLfo(mod);
+	mod->lfoPhase += mod->lfoStep;
+
+	switch(mod->type){
+	case MOD_TYPE_FM:
+		dds->tuningWord = carrierWord + (int32_t)(((int64_t)mod->depth * lfo) >> 15);
+		break;
+
+	case MOD_TYPE_PM: {
+		int32_t offset = (int32_t)(((int64_t)mod->depth * lfo) >> 15);
+		dds->phase			+= (uint32_t)offset - (uint32_t)mod->phaseOffset;	// Wraps, where int32 would overflow
+		mod->phaseOffset	= offset;
+		break;
+	}
+
+	default:
+		break;
+	}
+	return lfo;
+}
+
+// Leveling stage for one block.  AM scales the gain by 1 + depth * lfo about the level's own centre, so the DC
+// offset stays put; other types return level unchanged
+Synth_LevelTypeDef modLevel(const Mod_HandleTypeDef * mod, Synth_LevelTypeDef level, int32_t lfo){
+	if(mod->type != MOD_TYPE_AM){
+		return level;
+	}
+	int32_t scale	= SYNTH_GAIN_ONE + (int32_t)(((int64_t)mod->depth * lfo) >> 16);	// Q14, 0..2 at full depth
+	int32_t gain	= (level.gain * scale + SYNTH_GAIN_ONE / 2) >> 14;
+	if(gain > INT16_MAX){
+		gain = INT16_MAX;
+	}
+	// Centre (full scale / 2) is fixed: base moves by half the change in gain
+	int32_t base = level.base + ((int32_t)SYNTH_FULL_SCALE * (level.gain - gain) + SYNTH_GAIN_ONE) / (2 * SYNTH_GAIN_ONE);
+
+	Synth_LevelTypeDef out;
+	out.gain	= (int16_t)gain;
+	out.base	= (int16_t)base;
+	return out;
+}
+
+// LFO value at the current phase, -MOD_LFO_ONE..MOD_LFO_ONE
+static int32_t modLfo(const Mod_HandleTypeDef * mod){
+	switch(mod->shape){
+	case MOD_SHAPE_SQUARE:
+		return (mod->lfoPhase < 0x80000000UL ? MOD_LFO_ONE : -MOD_LFO_ONE);
+
+	case MOD_SHAPE_RAMP:
+		return (int32_t)((mod->lfoPhase >> 16) | 1) - 32768;
+
+	default:
+		// Table codes 0..DDS_FULL_SCALE about mid-scale, scaled to Q15
+		return ((int32_t)mod->table[((uint64_t)mod->lfoPhase * DDS_TABLE_SIZE) >> 32] * 2 - DDS_FULL_SCALE) * 8;
+	}
+}
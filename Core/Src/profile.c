@@ -0,0 +1,73 @@
+/*
+ * profile.c
+ *
+ *  Created on: 10/18/2026
+ */
+
+#include "profile.h"
+
+#define PROFILE_DWT_UNLOCK			0xC5ACCE55	// DWT lock access key on the M7
+
+static Profile_SlotTypeDef slots[2][PROFILE_SLOTS];	// [caches on][slot]
+
+// Starts the DWT cycle counter.  Called once, before any profileStart()
+void profileInit(void){
+	CoreDebug->DEMCR	|= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR			= PROFILE_DWT_UNLOCK;
+	DWT->CYCCNT			= 0;
+	DWT->CTRL			|= DWT_CTRL_CYCCNTENA_Msk;
+	profileReset();
+}
+
+void profileReset(void){
+	for(uint8_t cached = 0; cached < 2; cached++){
+		for(uint8_t i = 0; i < PROFILE_SLOTS; i++){
+			slots[cached][i].count	= 0;
+			slots[cached][i].last	= 0;
+			slots[cached][i].min	= UINT32_MAX;
+			slots[cached][i].max	= 0;
+			slots[cached][i].total	= 0;
+		}
+	}
+}
+
+// Turns the I- and D-caches on or off together.  Interrupts are masked while the D-cache is cleaned and
+// switched, since a DMA callback writing to a line mid-clean could otherwise lose its data
+void profileSetCaches(uint8_t enabled){
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	if(enabled){
+		SCB_EnableICache();
+		SCB_EnableDCache();
+	}else{
+		SCB_DisableDCache();
+		SCB_DisableICache();
+	}
+	__set_PRIMASK(primask);
+}
+
+const Profile_SlotTypeDef * profileGet(uint8_t cached, uint8_t slot){
+	if(slot >= PROFILE_SLOTS){
+		return NULL;
+	}
+	return &slots[cached ? 1 : 0][slot];
+}
+
+// Slots are shared between the main loop and the DMA interrupts, so the update is done with interrupts masked
+void profileStop(uint8_t slot, uint32_t start){
+	uint32_t cycles = DWT->CYCCNT - start;
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	Profile_SlotTypeDef * s = &slots[(SCB->CCR & SCB_CCR_DC_Msk) ? 1 : 0][slot];
+
+	s->last		= cycles;
+	s->total	+= cycles;
+	s->count++;
+	if(cycles < s->min){
+		s->min = cycles;
+	}
+	if(cycles > s->max){
+		s->max = cycles;
+	}
+	__set_PRIMASK(primask);
+}
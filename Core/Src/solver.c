@@ -0,0 +1,70 @@
+/*
+ * solver.c
+ *
+ *  Created on: 10/18/2026
+ */
+
+#include "solver.h"
+
+#define SOLVER_TICK_MILLIHZ		((uint64_t)SOLVER_TIMER_CLOCK_HZ * 1000)	// Timer ticks per cycle times mHz
+#define SOLVER_MAX_TICKS		(65536ULL * 65536ULL)						// Largest (PSC + 1) * (ARR + 1)
+
+// Finds TIM6 PSC, ARR and the samples per cycle for a frequency in millihertz.  Sample counts are tried from the
+// largest down, so the first one within SOLVER_GOOD_PPB wins and gives the cleanest waveform; otherwise the
+// smallest error found is kept.  Returns 0 if the frequency cannot be produced at all
+uint8_t solverFind(uint32_t milliHz, Solver_ResultTypeDef * result){
+	if(milliHz == 0){
+		return 0;
+	}
+
+	// Cap the sample count so the DAC update rate stays at or below TIM_CLOCK / SOLVER_MIN_TICKS.  Rounded rather
+	// than truncated: the count just above the exact limit still works with the tick count clamped below
+	uint64_t maxSamples = (SOLVER_TICK_MILLIHZ + (uint64_t)milliHz * SOLVER_MIN_TICKS / 2) / ((uint64_t)milliHz * SOLVER_MIN_TICKS);
+	if(maxSamples > SOLVER_MAX_SAMPLES){
+		maxSamples = SOLVER_MAX_SAMPLES;
+	}
+	if(maxSamples < SOLVER_MIN_SAMPLES){
+		return 0;
+	}
+
+	uint8_t found 		= 0;
+	uint32_t bestError	= 0xFFFFFFFF;
+
+	for(uint32_t n = maxSamples; n >= SOLVER_MIN_SAMPLES; n--){
+		uint64_t perSample	= (uint64_t)milliHz * n;
+		uint64_t ticks		= (SOLVER_TICK_MILLIHZ + perSample / 2) / perSample;
+		if(ticks > SOLVER_MAX_TICKS){
+			break;									// Fewer samples only need more ticks
+		}
+		if(ticks < SOLVER_MIN_TICKS){
+			ticks = SOLVER_MIN_TICKS;
+		}
+
+		// Smallest prescaler that lets ARR reach, then the ARR closest to the wanted tick count
+		uint32_t psc = (uint32_t)((ticks + 65535) >> 16);
+		uint32_t arr = (uint32_t)((ticks + psc / 2) / psc);
+		if(arr > 65536){
+			arr = 65536;
+		}
+
+		uint64_t produced	= (uint64_t)psc * arr * perSample;		// Equals SOLVER_TICK_MILLIHZ when exact
+		uint64_t diff		= produced > SOLVER_TICK_MILLIHZ ? produced - SOLVER_TICK_MILLIHZ : SOLVER_TICK_MILLIHZ - produced;
+		uint64_t ppb		= diff * 1000000000ULL / produced;
+		if(ppb >= bestError){
+			continue;
+		}
+
+		uint64_t divider		= (uint64_t)psc * arr * n;
+		result->prescaler		= psc - 1;
+		result->period			= arr - 1;
+		result->samples			= n;
+		result->actualMilliHz	= (uint32_t)((SOLVER_TICK_MILLIHZ + divider / 2) / divider);
+		result->errorPpb		= produced > SOLVER_TICK_MILLIHZ ? -(int32_t)ppb : (int32_t)ppb;
+		bestError				= ppb;
+		found					= 1;
+		if(ppb <= SOLVER_GOOD_PPB){
+			break;
+		}
+	}
+	return found;
+}
@@ -0,0 +1,69 @@
+/*
+ * sweep.c
+ *
+ *  Created on: 10/18/2026
+ */
+
+#include "sweep.h"
+#include <math.h>
+
+Sweep_HandleTypeDef sweep_create(void){
+
+	Sweep_HandleTypeDef sweep;
+
+	sweep.tuningWord	= 0;
+	sweep.step			= 0;
+	sweep.startWord		= 0;
+	sweep.stopWord		= 0;
+	sweep.updates		= 0;
+	sweep.position		= 0;
+	sweep.law			= SWEEP_LAW_LINEAR;
+	sweep.repeat		= 0;
+	sweep.active		= 0;
+
+	return sweep;
+}
+
+// Sets up one pass of 'updates' tuning words from startWord to stopWord.  Does not start the sweep; set
+// sweep->active once the caller is ready.  Returns 0 for a sweep that cannot be built
+uint8_t sweepConfigure(Sweep_HandleTypeDef * sweep, uint32_t startWord, uint32_t stopWord, uint32_t updates,
+		uint8_t law, uint8_t repeat){
+	if(updates < 2 || (law == SWEEP_LAW_LOG && (startWord == 0 || stopWord == 0))){
+		return 0;
+	}
+	sweep->active		= 0;
+	sweep->startWord	= startWord;
+	sweep->stopWord		= stopWord;
+	sweep->updates		= updates;
+	sweep->position		= 0;
+	sweep->law			= law;
+	sweep->repeat		= repeat;
+	sweep->tuningWord	= startWord;
+	if(law == SWEEP_LAW_LOG){
+		sweep->step = pow((double)stopWord / startWord, 1.0 / (updates - 1));
+	}else{
+		sweep->step = ((double)stopWord - startWord) / (updates - 1);
+	}
+	return 1;
+}
+
+// Tuning word for the next block of samples; called from the DMA refill interrupt.  At the end of a pass the
+// sweep either wraps to the start or clears 'active' and holds the stop word
+uint32_t sweepNext(Sweep_HandleTypeDef * sweep){
+	uint32_t word = (uint32_t)(sweep->tuningWord + 0.5);
+
+	if(++sweep->position >= sweep->updates){
+		sweep->position = 0;
+		if(sweep->repeat){
+			sweep->tuningWord = sweep->startWord;
+		}else{
+			sweep->tuningWord = sweep->stopWord;
+			sweep->active = 0;
+		}
+	}else if(sweep->law == SWEEP_LAW_LOG){
+		sweep->tuningWord *= sweep->step;
+	}else{
+		sweep->tuningWord += sweep->step;
+	}
+	return word;
+}
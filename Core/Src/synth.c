@@ -0,0 +1,274 @@
+/*
+ * synth.c
+ *
+ *  Created on: 10/18/2026
+ */
+
+#include "synth.h"
+#include "cordic.h"
+#include "blep.h"
+
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#include "cmsis_compiler.h"
+#endif
+
+static void synthAddResidual(uint16_t * buf, uint16_t count, uint32_t edge, const int16_t (* table)[SYNTH_BLEP_TAPS],
+		int64_t scale, uint8_t shift);
+static void synthReverse(uint16_t * buf, uint16_t count);
+static uint32_t synthRampTop(uint16_t count, uint16_t tenths);
+
+#define SYNTH_BATCH	32					// Angles handed to the CORDIC per call
+
+// A band-limited step overshoots by 5.9% either side, so the band-limited square swings over 1 / 1.12 of full scale
+#define SYNTH_BLEP_LOW		219
+#define SYNTH_BLEP_SWING	3656
+
+// Minimax fit of sin(pi/2 * u) = u * (C1 + C3 u^2 + C5 u^4 + C7 u^6) on [-1, 1], Q30.  Max error 6e-7 (~0.001 LSB)
+#define SIN_C1		1686624005LL
+#define SIN_C3		-693522166LL
+#define SIN_C5		85291977LL
+#define SIN_C7		-4652625LL
+
+// Sine of a single 32-bit phase (2^32 = one turn) in Q30.  Buffers go through synthSine() and the CORDIC instead
+int32_t synthSinQ30(uint32_t phase){
+	int32_t u = (int32_t)phase;
+
+	// Fold the 2nd and 3rd quadrants onto the 1st and 4th so u covers -pi/2..pi/2 as -2^30..2^30
+	if((u ^ (int32_t)((uint32_t)u << 1)) < 0){
+		u = (int32_t)(0x80000000UL - (uint32_t)u);
+	}
+
+	int64_t u2 = ((int64_t)u * u) >> 30;
+	int64_t y = SIN_C7;
+	y = SIN_C5 + ((y * u2) >> 30);
+	y = SIN_C3 + ((y * u2) >> 30);
+	y = SIN_C1 + ((y * u2) >> 30);
+	return (int32_t)((y * u) >> 30);
+}
+
+// Maps -1.0..1.0 (Q30) onto 0..SYNTH_FULL_SCALE, rounded
+uint16_t synthQ30ToDac(int32_t value){
+	return (uint16_t)((((int64_t)value + SYNTH_Q30_ONE) * SYNTH_FULL_SCALE + SYNTH_Q30_ONE) >> 31);
+}
+
+// Resamples a one-cycle table to count entries, nearest entry at or before each point.  When count divides
+// tableSize this is a plain strided copy
+void synthDecimate(uint16_t * buf, uint16_t count, const uint16_t * table, uint16_t tableSize){
+	uint16_t stride		= tableSize / count;
+	uint16_t remainder	= tableSize % count;
+	uint16_t index		= 0;
+	uint16_t error		= 0;
+	for(uint16_t i = 0; i < count; i++){
+		buf[i] = table[index];
+		index += stride;
+		error += remainder;
+		if(error >= count){
+			error -= count;
+			index++;
+		}
+	}
+}
+
+// Rising edge over tenths / 10 % of the cycle, falling edge over the rest.  The top corner is placed to 1/65536 of
+// a sample rather than on the nearest one, so symmetry stays accurate with only a few samples per cycle
+void synthRamp(uint16_t * buf, uint16_t count, uint16_t tenths){
+	uint32_t end = (uint32_t)count << 16;
+	uint32_t top = synthRampTop(count, tenths);
+
+	// Sample i sits at t = i + 1, so the last sample is the bottom corner
+	for(uint16_t i = 0; i < count; i++){
+		uint32_t t = (uint32_t)(i + 1) << 16;
+		if(t <= top){
+			buf[i] = (uint16_t)(((uint64_t)SYNTH_FULL_SCALE * t + top / 2) / top);
+		}else{
+			buf[i] = (uint16_t)(((uint64_t)SYNTH_FULL_SCALE * (end - t) + (end - top) / 2) / (end - top));
+		}
+	}
+}
+
+// Band-limited version of synthRamp().  Both corners are rounded off with BLAMP corrections so nothing above the
+// kernel's cutoff is left to alias
+void synthRampBlamp(uint16_t * buf, uint16_t count, uint16_t tenths){
+	uint32_t end = (uint32_t)count << 16;
+	uint32_t top = synthRampTop(count, tenths);
+	synthRamp(buf, count, tenths);
+
+	// Change of slope at each corner, Q16 codes per sample
+	int64_t bend = (((int64_t)SYNTH_FULL_SCALE << 32) / top) + (((int64_t)SYNTH_FULL_SCALE << 32) / (end - top));
+	synthAddResidual(buf, count, end - 0x10000, BLAMP_residual, bend, 31);
+	synthAddResidual(buf, count, top - 0x10000, BLAMP_residual, -bend, 31);
+}
+
+// Top corner of the ramp in Q16 samples, kept at least one sample from either end
+static uint32_t synthRampTop(uint16_t count, uint16_t tenths){
+	uint32_t end = (uint32_t)count << 16;
+	uint32_t top = synthDutyEdge(count, tenths);
+	if(top < 0x10000){
+		top = 0x10000;
+	}else if(top > end - 0x10000){
+		top = end - 0x10000;
+	}
+	return top;
+}
+
+// One cycle of sine over count samples, computed by the CORDIC in batches.  The phase step is split into its
+// integer and remainder parts so that sample i sits at exactly i * 2^32 / count
+void synthSine(uint16_t * buf, uint16_t count){
+	int32_t angle[SYNTH_BATCH];
+	int32_t sine[SYNTH_BATCH];
+	uint32_t step		= (uint32_t)(0x100000000ULL / count);
+	uint32_t remainder	= (uint32_t)(0x100000000ULL % count);
+	uint32_t phase		= 0;
+	uint32_t error		= 0;
+	uint16_t batch;
+
+	for(uint16_t i = 0; i < count; i += batch){
+		batch = (count - i < SYNTH_BATCH ? count - i : SYNTH_BATCH);
+		for(uint16_t k = 0; k < batch; k++){
+			angle[k] = (int32_t)phase;
+			phase += step;
+			error += remainder;
+			if(error >= count){
+				error -= count;
+				phase++;
+			}
+		}
+		cordicSinCos(angle, sine, 0, batch);
+		for(uint16_t k = 0; k < batch; k++){
+			buf[i + k] = synthQ30ToDac(sine[k] >> 1);
+		}
+	}
+}
+
+// High for the first tenths / 10 % of the cycle.  The sample the falling edge lands in takes the fraction of it
+// that is still high, so the average level, and with it the effective duty, is exact to 1/65536 of a sample
+void synthSquare(uint16_t * buf, uint16_t count, uint16_t tenths){
+	synthSquareSpan(buf, count, tenths, 0, count);
+}
+
+// Writes samples start..end - 1 of synthSquare()'s cycle, so a moved edge can be patched without regenerating
+void synthSquareSpan(uint16_t * buf, uint16_t count, uint16_t tenths, uint16_t start, uint16_t end){
+	uint32_t edge = synthDutyEdge(count, tenths);
+	for(uint16_t i = start; i < end; i++){
+		uint32_t t = (uint32_t)i << 16;
+		if(t + 0x10000 <= edge){
+			buf[i] = SYNTH_FULL_SCALE;
+		}else if(t >= edge){
+			buf[i] = 0;
+		}else{
+			buf[i] = (uint16_t)(((edge - t) * SYNTH_FULL_SCALE + 0x8000) >> 16);
+		}
+	}
+}
+
+// Falling edge (square) or top corner (ramp) for a duty of tenths / 10 % over count samples, Q16 samples
+uint32_t synthDutyEdge(uint16_t count, uint16_t tenths){
+	return (uint32_t)(((uint64_t)tenths * ((uint32_t)count << 16) + SYNTH_DUTY_FULL / 2) / SYNTH_DUTY_FULL);
+}
+
+// Band-limited version of synthSquare().  The falling edge may fall between samples, and both edges get BLEP
+// corrections.  The swing is reduced to SYNTH_BLEP_SWING so the ringing stays inside the DAC range
+void synthSquareBlep(uint16_t * buf, uint16_t count, uint16_t tenths){
+	uint32_t edge = synthDutyEdge(count, tenths);
+	uint16_t i;
+	for(i = 0; ((uint32_t)i << 16) < edge; i++){
+		buf[i] = SYNTH_BLEP_LOW + SYNTH_BLEP_SWING;
+	}
+	for(; i < count; i++){
+		buf[i] = SYNTH_BLEP_LOW;
+	}
+	synthAddResidual(buf, count, 0, BLEP_residual, SYNTH_BLEP_SWING, 15);
+	synthAddResidual(buf, count, edge, BLEP_residual, -SYNTH_BLEP_SWING, 15);
+}
+
+// Adds (scale * table row) >> shift around an edge at Q16 sample position edge, wrapping round the cycle
+static void synthAddResidual(uint16_t * buf, uint16_t count, uint32_t edge, const int16_t (* table)[SYNTH_BLEP_TAPS],
+		int64_t scale, uint8_t shift){
+	uint32_t whole = edge >> 16;
+	uint32_t row = ((edge & 0xFFFF) * SYNTH_BLEP_PHASES + 0x8000) >> 16;
+	if(row == SYNTH_BLEP_PHASES){
+		row = 0;
+		whole++;
+	}
+
+	uint32_t index = (whole + count - SYNTH_BLEP_TAPS / 2 + 1) % count;
+	for(uint8_t k = 0; k < SYNTH_BLEP_TAPS; k++){
+		int32_t v = buf[index] + (int32_t)((scale * table[row][k] + ((int64_t)1 << (shift - 1))) >> shift);
+		buf[index] = (uint16_t)(v < 0 ? 0 : (v > SYNTH_FULL_SCALE ? SYNTH_FULL_SCALE : v));
+		if(++index == count){
+			index = 0;
+		}
+	}
+}
+
+// Rotates buf left by shift entries in place, so buf[0] becomes the old buf[shift].  Three reversals, no scratch
+void synthRotate(uint16_t * buf, uint16_t count, uint16_t shift){
+	if(shift == 0 || shift >= count){
+		return;
+	}
+	synthReverse(buf, shift);
+	synthReverse(buf + shift, count - shift);
+	synthReverse(buf, count);
+}
+
+// Level for a peak-to-peak amplitude in DAC codes (0 to SYNTH_FULL_SCALE) centred offset codes away from mid-scale.
+// Full scale with no offset is exactly the identity
+Synth_LevelTypeDef synthLevel(uint16_t amplitude, int16_t offset){
+	Synth_LevelTypeDef level;
+
+	if(amplitude > SYNTH_FULL_SCALE){
+		amplitude = SYNTH_FULL_SCALE;
+	}
+	level.gain = (int16_t)(((uint32_t)amplitude * SYNTH_GAIN_ONE + SYNTH_FULL_SCALE / 2) / SYNTH_FULL_SCALE);
+
+	// Keep mid-scale (4095 / 2) where it was, then shift it by offset.  Past a full scale either way every sample
+	// saturates anyway, so base is held there rather than wrap in the int16_t
+	int32_t base = (int32_t)(((uint32_t)SYNTH_FULL_SCALE * (SYNTH_GAIN_ONE - level.gain) + SYNTH_GAIN_ONE) / (2 * SYNTH_GAIN_ONE)) + offset;
+	if(base > SYNTH_FULL_SCALE){
+		base = SYNTH_FULL_SCALE;
+	}else if(base < -SYNTH_FULL_SCALE){
+		base = -SYNTH_FULL_SCALE;
+	}
+	level.base = (int16_t)base;
+	return level;
+}
+
+// dst[i] = src[i] * gain + base, rounded and clamped to 0..SYNTH_FULL_SCALE.  src and dst may be the same buffer.
+// On the M7 each pair of samples is one word load, two dual 16-bit multiply-accumulates (SMLAD: sample * gain plus
+// 16384 * base plus the rounding term), two USATs and one word store
+void synthApplyLevel(const uint16_t * src, uint16_t * dst, uint16_t count, Synth_LevelTypeDef level){
+	if(level.gain == SYNTH_GAIN_ONE && level.base == 0){
+		if(src != dst){
+			for(uint16_t i = 0; i < count; i++){
+				dst[i] = src[i];
+			}
+		}
+		return;
+	}
+
+	uint16_t i = 0;
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+	uint32_t coef = __PKHBT((uint16_t)level.gain, (uint16_t)level.base, 16);
+	uint32_t one = (uint32_t)SYNTH_GAIN_ONE << 16;
+
+	for(; i + 2 <= count; i += 2){
+		uint32_t pair = __UNALIGNED_UINT32_READ(&src[i]);
+		int32_t lo = (int32_t)__SMLAD(__PKHBT(pair, one, 0), coef, SYNTH_GAIN_ONE / 2);
+		int32_t hi = (int32_t)__SMLAD(__PKHTB(one, pair, 16), coef, SYNTH_GAIN_ONE / 2);
+		__UNALIGNED_UINT32_WRITE(&dst[i], __PKHBT(__USAT(lo >> 14, 12), __USAT(hi >> 14, 12), 16));
+	}
+#endif
+	for(; i < count; i++){
+		int32_t v = ((int32_t)src[i] * level.gain + (int32_t)level.base * SYNTH_GAIN_ONE + SYNTH_GAIN_ONE / 2) >> 14;
+		dst[i] = (uint16_t)(v < 0 ? 0 : (v > SYNTH_FULL_SCALE ? SYNTH_FULL_SCALE : v));
+	}
+}
+
+static void synthReverse(uint16_t * buf, uint16_t count){
+	uint16_t * end = buf + count - 1;
+	while(buf < end){
+		uint16_t t = *buf;
+		*buf++ = *end;
+		*end-- = t;
+	}
+}
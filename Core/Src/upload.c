@@ -0,0 +1,284 @@
+/*
+ * upload.c
+ *
+ *  Created on: 10/18/2026
+ */
+
+#include "upload.h"
+#include "dmabuf.h"
+#include "profile.h"
+
+#define UPLOAD_STATE_COMMAND		0			// Waiting for a command byte
+#define UPLOAD_STATE_ARGS			1			// Collecting the command's arguments
+#define UPLOAD_STATE_DATA			2			// Collecting chunk samples
+#define UPLOAD_STATE_DISCARD		3			// Skipping the payload of a refused chunk
+
+#define UPLOAD_FULL_SCALE			4095
+
+DMA_RX_BUFFER static uint8_t rxRing[UPLOAD_RING_SIZE];	// Invalidated on every receive event, the CPU never writes it
+static uint16_t waves[2][UPLOAD_MAX_SAMPLES];
+static Upload_HandleTypeDef * active;			// Handle the UART callbacks report to
+
+static void reply(Upload_HandleTypeDef * upload, uint8_t code);
+static void sendProfile(Upload_HandleTypeDef * upload);
+static void execute(Upload_HandleTypeDef * upload);
+static void parse(Upload_HandleTypeDef * upload, uint8_t byte);
+
+Upload_HandleTypeDef upload_create(UART_HandleTypeDef * huart){
+
+	Upload_HandleTypeDef upload;
+
+	upload.huart		= huart;
+	upload.head			= 0;
+	upload.tail			= 0;
+	upload.restarted	= 0;
+	upload.state		= UPLOAD_STATE_COMMAND;
+	upload.command		= 0;
+	upload.argCount		= 0;
+	upload.argLen		= 0;
+	upload.lowByte		= 0;
+	upload.haveLow		= 0;
+	upload.chunkLeft	= 0;
+	upload.expected		= 0;
+	upload.received		= 0;
+	upload.spare		= 0;
+	upload.ready		= 0;
+	upload.lastByte		= 0;
+
+	return upload;
+}
+
+// Starts circular DMA reception into the ring.  The handle must stay at the same address from here on
+HAL_StatusTypeDef uploadStart(Upload_HandleTypeDef * upload){
+	active 				= upload;
+	upload->head		= 0;
+	upload->tail		= 0;
+	upload->restarted	= 1;						// Tells a uploadPoll() loop this runs under to stop reading
+	return HAL_UARTEx_ReceiveToIdle_DMA(upload->huart, rxRing, UPLOAD_RING_SIZE);
+}
+
+// Re-initialises the UART at a new baud rate and restarts reception; anything still in the ring is dropped
+HAL_StatusTypeDef uploadSetBaud(Upload_HandleTypeDef * upload, uint32_t baud){
+	if(baud < UPLOAD_MIN_BAUD || baud > UPLOAD_MAX_BAUD){
+		return HAL_ERROR;
+	}
+	HAL_UART_AbortReceive(upload->huart);
+	upload->huart->Init.BaudRate = baud;
+	if(HAL_UART_Init(upload->huart) != HAL_OK){
+		return HAL_ERROR;
+	}
+	upload->state = UPLOAD_STATE_COMMAND;
+	return uploadStart(upload);
+}
+
+// Parses everything received since the last call.  Returns a committed waveform and its length once all of it
+// has arrived, otherwise NULL.  The caller must hand it to the output and then call uploadAccept()
+const uint16_t * uploadPoll(Upload_HandleTypeDef * upload, uint16_t * size){
+	if(upload->ready){
+		return NULL;
+	}
+	if(upload->restarted){
+		upload->restarted	= 0;
+		upload->tail		= 0;
+		upload->state		= UPLOAD_STATE_COMMAND;
+	}
+	if(upload->state != UPLOAD_STATE_COMMAND && HAL_GetTick() - upload->lastByte > UPLOAD_TIMEOUT_MS){
+		upload->state = UPLOAD_STATE_COMMAND;
+	}
+
+	// A baud change ('B') or a UART error restarts the ring at index 0 underneath this loop.  The bytes after
+	// the restart point are stale, so reading starts over at 0 instead of advancing past the old tail
+	while(upload->tail != upload->head && !upload->ready){
+		parse(upload, rxRing[upload->tail]);
+		if(upload->restarted){
+			upload->restarted	= 0;
+			upload->tail		= 0;
+			upload->state		= UPLOAD_STATE_COMMAND;
+		}else{
+			upload->tail = (upload->tail + 1) % UPLOAD_RING_SIZE;
+		}
+	}
+	if(!upload->ready){
+		return NULL;
+	}
+	*size = upload->expected;
+	return waves[upload->spare];
+}
+
+// The output has switched to the waveform uploadPoll() returned, so the other buffer is free for the next upload
+void uploadAccept(Upload_HandleTypeDef * upload){
+	upload->spare		^= 1;
+	upload->expected	= 0;
+	upload->ready		= 0;
+	reply(upload, UPLOAD_ACK);
+}
+
+static void reply(Upload_HandleTypeDef * upload, uint8_t code){
+	HAL_UART_Transmit(upload->huart, &code, 1, 10);
+}
+
+// Profile report, see upload.h.  Sent blocking from the main loop, the same as the ACKs
+static void sendProfile(Upload_HandleTypeDef * upload){
+	uint8_t report[2 * PROFILE_SLOTS * 16];
+	uint8_t * p = report;
+
+	for(uint8_t cached = 0; cached < 2; cached++){
+		for(uint8_t slot = 0; slot < PROFILE_SLOTS; slot++){
+			const Profile_SlotTypeDef * s = profileGet(cached, slot);
+			uint32_t fields[4];
+			fields[0] = s->count;
+			fields[1] = (s->count ? s->min : 0);
+			fields[2] = s->max;
+			fields[3] = (s->count ? (uint32_t)(s->total / s->count) : 0);
+			for(uint8_t f = 0; f < 4; f++){
+				*p++ = fields[f];
+				*p++ = fields[f] >> 8;
+				*p++ = fields[f] >> 16;
+				*p++ = fields[f] >> 24;
+			}
+		}
+	}
+	reply(upload, UPLOAD_ACK);
+	HAL_UART_Transmit(upload->huart, report, sizeof(report), 100);
+}
+
+static void parse(Upload_HandleTypeDef * upload, uint8_t byte){
+	upload->lastByte = HAL_GetTick();
+
+	switch(upload->state){
+	case UPLOAD_STATE_COMMAND:
+		upload->command 	= byte;
+		upload->argCount	= 0;
+		switch(byte){
+		case 'B':
+			upload->argLen = 4;
+			break;
+		case 'W':
+		case 'D':
+			upload->argLen = 2;
+			break;
+		case 'K':
+			upload->argLen = 1;
+			break;
+		case 'C':
+		case 'P':
+			upload->argLen = 0;
+			execute(upload);
+			return;
+		default:
+			reply(upload, UPLOAD_NAK);
+			return;
+		}
+		upload->state = UPLOAD_STATE_ARGS;
+		break;
+
+	case UPLOAD_STATE_ARGS:
+		upload->args[upload->argCount++] = byte;
+		if(upload->argCount == upload->argLen){
+			upload->state = UPLOAD_STATE_COMMAND;
+			execute(upload);
+		}
+		break;
+
+	case UPLOAD_STATE_DATA:
+		if(!upload->haveLow){
+			upload->lowByte = byte;
+			upload->haveLow = 1;
+			break;
+		}
+		upload->haveLow = 0;
+		uint16_t sample = upload->lowByte | ((uint16_t)byte << 8);
+		waves[upload->spare][upload->received++] = (sample > UPLOAD_FULL_SCALE ? UPLOAD_FULL_SCALE : sample);
+		if(--upload->chunkLeft == 0){
+			upload->state = UPLOAD_STATE_COMMAND;
+			reply(upload, UPLOAD_ACK);
+		}
+		break;
+
+	case UPLOAD_STATE_DISCARD:
+		if(--upload->chunkLeft == 0){
+			upload->state = UPLOAD_STATE_COMMAND;
+		}
+		break;
+	}
+}
+
+static void execute(Upload_HandleTypeDef * upload){
+	uint16_t arg16 = upload->args[0] | ((uint16_t)upload->args[1] << 8);
+
+	switch(upload->command){
+	case 'B': {
+		uint32_t baud = arg16 | ((uint32_t)upload->args[2] << 16) | ((uint32_t)upload->args[3] << 24);
+		if(baud < UPLOAD_MIN_BAUD || baud > UPLOAD_MAX_BAUD){
+			reply(upload, UPLOAD_NAK);
+			break;
+		}
+		reply(upload, UPLOAD_ACK);					// Blocking, so the ACK is out before the rate changes
+		uploadSetBaud(upload, baud);
+		break;
+	}
+
+	case 'W':
+		if(arg16 < UPLOAD_MIN_SAMPLES || arg16 > UPLOAD_MAX_SAMPLES){
+			reply(upload, UPLOAD_NAK);
+			break;
+		}
+		upload->expected	= arg16;
+		upload->received	= 0;
+		reply(upload, UPLOAD_ACK);
+		break;
+
+	case 'D':
+		if(arg16 == 0){
+			reply(upload, UPLOAD_NAK);
+		}else if(arg16 > UPLOAD_MAX_CHUNK || upload->expected == 0 || upload->received + arg16 > upload->expected){
+			// Skip the payload so it is not parsed as commands, then refuse the chunk
+			upload->chunkLeft	= arg16 * 2;
+			upload->state		= UPLOAD_STATE_DISCARD;
+			reply(upload, UPLOAD_NAK);
+		}else{
+			upload->chunkLeft	= arg16;
+			upload->haveLow		= 0;
+			upload->state		= UPLOAD_STATE_DATA;
+		}
+		break;
+
+	case 'C':
+		if(upload->expected != 0 && upload->received == upload->expected){
+			upload->ready = 1;						// ACK is sent by uploadAccept() once the waveform is playing
+		}else{
+			reply(upload, UPLOAD_NAK);
+		}
+		break;
+
+	case 'K':
+		if(upload->args[0] > 1){
+			reply(upload, UPLOAD_NAK);
+			break;
+		}
+		profileSetCaches(upload->args[0]);
+		reply(upload, UPLOAD_ACK);
+		break;
+
+	case 'P':
+		sendProfile(upload);
+		break;
+	}
+}
+
+// Called by the HAL on idle line, half ring and full ring.  Size is the DMA write position in the ring
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef * huart, uint16_t Size){
+	if(active != NULL && huart == active->huart){
+		dmaBufferInvalidate(rxRing, sizeof(rxRing));		// Before head moves, so the parser never reads stale lines
+		active->head = Size % UPLOAD_RING_SIZE;
+	}
+}
+
+// Overrun, framing or noise errors stop reception in the HAL; start it again and let the host retry on timeout
+void HAL_UART_ErrorCallback(UART_HandleTypeDef * huart){
+	if(active != NULL && huart == active->huart){
+		active->head		= 0;
+		active->restarted	= 1;
+		HAL_UARTEx_ReceiveToIdle_DMA(huart, rxRing, UPLOAD_RING_SIZE);
+	}
+}
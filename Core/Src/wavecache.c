@@ -0,0 +1,100 @@
+/*
+ * wavecache.c
+ *
+ *  Created on: 10/18/2026
+ */
+
+#include "wavecache.h"
+#include <stddef.h>
+
+static int8_t waveCacheIndex(const WaveCache_HandleTypeDef * cache, const WaveCache_KeyTypeDef * key);
+static uint8_t waveCacheKeyEqual(const WaveCache_KeyTypeDef * a, const WaveCache_KeyTypeDef * b);
+
+// storage holds WAVE_CACHE_SLOTS buffers of slotSize samples back to back
+WaveCache_HandleTypeDef waveCache_create(uint16_t * storage, uint16_t slotSize){
+
+	WaveCache_HandleTypeDef cache;
+
+	for(uint8_t i = 0; i < WAVE_CACHE_SLOTS; i++){
+		cache.slot[i].buffer	= storage + (uint32_t)i * slotSize;
+		cache.slot[i].lastUsed	= 0;
+		cache.slot[i].valid		= 0;
+	}
+	cache.clock		= 0;
+	cache.hits		= 0;
+	cache.misses	= 0;
+	cache.fills		= 0;
+
+	return cache;
+}
+
+// Hands out the least recently used slot, other than keepA / keepB (buffers DMA is playing or about to), for the
+// caller to fill with key's cycle.  The slot stays invalid until waveCacheCommit().  Returns NULL if every slot
+// is kept
+uint16_t * waveCacheClaim(WaveCache_HandleTypeDef * cache, const WaveCache_KeyTypeDef * key,
+		const uint16_t * keepA, const uint16_t * keepB){
+	WaveCache_SlotTypeDef * victim = NULL;
+	for(uint8_t i = 0; i < WAVE_CACHE_SLOTS; i++){
+		WaveCache_SlotTypeDef * slot = &cache->slot[i];
+		if(slot->buffer == keepA || slot->buffer == keepB){
+			continue;
+		}
+		if(!slot->valid){
+			victim = slot;
+			break;
+		}
+		if(victim == NULL || slot->lastUsed < victim->lastUsed){
+			victim = slot;
+		}
+	}
+	if(victim == NULL){
+		return NULL;
+	}
+	victim->valid	= 0;
+	victim->key		= *key;
+	return victim->buffer;
+}
+
+// Marks a claimed slot as holding its key's cycle
+void waveCacheCommit(WaveCache_HandleTypeDef * cache, const uint16_t * buffer){
+	for(uint8_t i = 0; i < WAVE_CACHE_SLOTS; i++){
+		if(cache->slot[i].buffer == buffer){
+			cache->slot[i].valid	= 1;
+			cache->slot[i].lastUsed	= ++cache->clock;
+			cache->fills++;
+			return;
+		}
+	}
+}
+
+// Lookup for the background filler; does not count as a hit or miss
+uint8_t waveCacheContains(const WaveCache_HandleTypeDef * cache, const WaveCache_KeyTypeDef * key){
+	return waveCacheIndex(cache, key) >= 0;
+}
+
+// Returns the cycle for key, or NULL, and counts the hit or miss
+uint16_t * waveCacheFind(WaveCache_HandleTypeDef * cache, const WaveCache_KeyTypeDef * key){
+	int8_t i = waveCacheIndex(cache, key);
+	if(i < 0){
+		cache->misses++;
+		return NULL;
+	}
+	cache->hits++;
+	cache->slot[i].lastUsed = ++cache->clock;
+	return cache->slot[i].buffer;
+}
+
+static int8_t waveCacheIndex(const WaveCache_HandleTypeDef * cache, const WaveCache_KeyTypeDef * key){
+	for(uint8_t i = 0; i < WAVE_CACHE_SLOTS; i++){
+		if(cache->slot[i].valid && waveCacheKeyEqual(&cache->slot[i].key, key)){
+			return i;
+		}
+	}
+	return -1;
+}
+
+static uint8_t waveCacheKeyEqual(const WaveCache_KeyTypeDef * a, const WaveCache_KeyTypeDef * b){
+	return a->waveform == b->waveform && a->bandLimited == b->bandLimited && a->samples == b->samples
+			&& a->dutyTenths == b->dutyTenths && a->level.gain == b->level.gain && a->level.base == b->level.base
+			&& a->arbSerial == b->arbSerial;
+}
@@ -10,9 +10,18 @@
 #include "string.h"
 #include "SH1106.h"
 #include "stdio.h"
+#include "dds.h"
+#include "synth.h"
+#include "cordic.h"
+#include "solver.h"
+#include "sweep.h"
+#include "modulate.h"
+#include "wavecache.h"
+#include "dmabuf.h"
+#include "profile.h"
+#include "mdmafill.h"
 
 #define ENCODER_PULSES_PER_STEP 2
-#define pi  3.14152
 
 // External Sprite Arrays from bitmap.h
 extern const uint8_t ramp10[];
@@ -35,7 +44,7 @@ extern const uint8_t square80[];
 extern const uint8_t square90[];
 extern const uint8_t sinewave[];
 extern const uint8_t TX_Icon[];
-extern const uint16_t ARR_period[];
+extern const uint16_t SINE_master[];
 
 extern uint16_t counter;
 extern int8_t counterUp;
@@ -62,7 +71,70 @@ const int MAIN_OPTIONS[7] = {
 	CURSOR_TX_XPOS
 };
 
-uint32_t TX_Bits[MAX_SAMPLES_PER_REV];				// Buffer which stores all the current waveform values
+DMA_BUFFER uint16_t TX_Bits[MAX_SAMPLES_PER_REV];				// Buffer which stores all the current waveform values, one 12-bit DAC code per halfword
+DMA_BUFFER uint16_t TX_Bits2[MAX_SAMPLES_PER_REV];				// DAC1 CH2 buffer, same length and layout as TX_Bits
+uint16_t TX_Raw[MAX_SAMPLES_PER_REV];				// Full-scale table-path cycles, kept so a level change only re-levels
+uint16_t TX_Raw2[MAX_SAMPLES_PER_REV];
+
+DDS_HandleTypeDef dds;								// Phase accumulator state; advanced by the DMA refill callbacks
+DDS_HandleTypeDef ddsNext;							// Settings waiting to be picked up at the next half-buffer boundary
+volatile uint8_t ddsUpdatePending	= 0;			// Set once ddsNext is complete, cleared by the refill that applies it
+volatile uint32_t refillMisses		= 0;			// Refills that finished after DMA had already reached their half
+DDS_HandleTypeDef dds2;								// CH2 engine; its phase is re-locked to CH1's at every block
+DDS_HandleTypeDef dds2Next;
+uint32_t ch2Offset		= 0;						// CH2 phase lead over CH1, 2^32 = one cycle
+uint32_t ch2OffsetNext	= 0;						// Staged with dds2Next under ddsUpdatePending
+uint8_t ch2Active		= 0;						// CH2 DMA runs alongside CH1
+Synth_LevelTypeDef ch1Level		= { SYNTH_GAIN_ONE, 0 };	// DDS output level, staged with ddsNext
+Synth_LevelTypeDef ch1LevelNext	= { SYNTH_GAIN_ONE, 0 };
+Synth_LevelTypeDef ch2Level		= { SYNTH_GAIN_ONE, 0 };
+Synth_LevelTypeDef ch2LevelNext	= { SYNTH_GAIN_ONE, 0 };
+uint8_t ddsEnabled 		= 0;						// Set while TX_Bits is a streaming DDS buffer rather than one cycle
+Solver_ResultTypeDef tableTiming;					// TIM6 and buffer settings for the table path at the current frequency
+Sweep_HandleTypeDef sweep;							// Stepped once per DDS half-buffer refill while active
+uint32_t sweepReturnMilliHz;						// wGen->milliHz before a one-shot sweep set it to its stop frequency
+uint32_t sweepStopMilliHz;							// Where that sweep ends
+Mod_HandleTypeDef modulation;						// Stepped every MOD_BLOCK samples of a DDS refill while active
+const uint16_t * arbTable	= SINE_master;			// One cycle of the user waveform, set by loadArbWaveform()
+uint16_t arbSize			= DDS_TABLE_SIZE;
+volatile uint8_t patchPending	= 0;				// Table-path square edge move waiting for DMA to get clear of it
+uint16_t patchStart;								// Samples patchStart..patchEnd - 1 are rewritten for patchTenths
+uint16_t patchEnd;
+uint16_t patchTenths;
+Synth_LevelTypeDef patchLevel;
+DMA_BUFFER uint16_t cacheBuffers[WAVE_CACHE_SLOTS][MAX_SAMPLES_PER_REV];	// Slot storage for waveCache
+WaveCache_HandleTypeDef waveCache;					// Ready-built table-path cycles, filled by cacheUpdate()
+uint16_t * activeBuf		= TX_Bits;				// Cycle CH1 DMA plays in the table path: TX_Bits or a cache slot
+uint16_t * pendingBuf		= TX_Bits;				// Cache slot to play from the next cycle boundary
+volatile uint8_t swapPending	= 0;				// Set until both DMA memory pointers are on pendingBuf
+uint32_t arbSerial			= 0;					// Counts uploads so cached ARB cycles from older ones never match
+MdmaFill_HandleTypeDef mdmaFill;					// Builds cache slots in the background, see cacheUpdate()
+uint16_t * mdmaSlot			= NULL;					// Cache slot the MDMA is filling, NULL when idle
+WaveCache_KeyTypeDef mdmaKey;						// Cycle mdmaSlot is being built for
+
+static void getWaveVal(wGen_HandleTypeDef * wGen);
+static void primeDds(wGen_HandleTypeDef * wGen);
+static void publishDds(wGen_HandleTypeDef * wGen);
+static void applyDds(void);
+static void refillHalf(uint8_t secondHalf);
+static void fillBlock(uint16_t start, uint16_t count);
+static void fillSpan(uint16_t start, uint16_t count, Synth_LevelTypeDef level1, Synth_LevelTypeDef level2);
+static void fillTable(wGen_HandleTypeDef * wGen, uint16_t * buf, uint8_t waveform);
+static void fillChannel1(wGen_HandleTypeDef * wGen, uint8_t waveform);
+static void fillChannel2(wGen_HandleTypeDef * wGen);
+static uint8_t patchDuty(wGen_HandleTypeDef * wGen, uint16_t oldTenths);
+static uint8_t applyPatch(void);
+static WaveCache_KeyTypeDef cacheKey(wGen_HandleTypeDef * wGen, uint8_t waveform);
+static uint8_t switchFromCache(wGen_HandleTypeDef * wGen);
+static uint8_t startMdmaSlot(uint16_t * buf, const WaveCache_KeyTypeDef * key);
+static void finishMdmaSlot(void);
+static void enableBufferSwap(void);
+static void advanceSwap(void);
+static void startOutput(void);
+static void stopOutput(void);
+static void refreshOutput(wGen_HandleTypeDef * wGen);
+static void setTimerRate(uint16_t prescaler, uint16_t period);
+static void applyFrequency(wGen_HandleTypeDef * wGen);
 
 void lcdInit(wGen_HandleTypeDef * wGen){
 	SH1106_DrawLine( 0, 50, 127, 50, 1);   			// Horizontal line above the data fields
@@ -86,7 +158,7 @@ void lcdInit(wGen_HandleTypeDef * wGen){
 
 	// Draw the current selection cursor, sine wave graphic, "TX:" and update the screen
 	SH1106_DrawTriangle(MAIN_OPTIONS[index] - 4, 45, MAIN_OPTIONS[index] + 4, 45, MAIN_OPTIONS[index], 49, 1);
-	SH1106_DrawBitmap(2, 0, sinewave, 80, 40, 1);
+	SH1106_DrawSprite(2, 0, sinewave, 80, 40, 1);
 	SH1106_GotoXY( 90 , 15);
 	SH1106_Puts("TX:", &Font_7x10, 1);
 	SH1106_UpdateScreen();
@@ -95,16 +167,31 @@ void lcdInit(wGen_HandleTypeDef * wGen){
 wGen_HandleTypeDef wGen_create(){
 
 	wGen_HandleTypeDef wGen;
+	Solver_ResultTypeDef timing;
 
 	wGen.clickConsumed			= 1; 	//wGen.counter contains all required info to draw the screen
 	wGen.counter 				= ROTARY_COUNTER_START;
-	wGen.currentBufSize			= TX_BUF_SIZE_MAX_100000_HZ;
 	wGen.currentStateBtn		= 0;
 	wGen.currentStateClk 		= 0;
 	wGen.currentMenuPos 		= 0;
-	wGen.currentWaveSelected 	= 0;	// 0 = SINE, 1 = SQR, 2 = RAMP;
+	wGen.currentWaveSelected 	= 0;	// 0 = SINE, 1 = SQR, 2 = RAMP, 3 = ARB;
 	wGen.currentPercent			= 50;
+	wGen.dutyTenths				= 500;
 	wGen.frequency				= 100000;
+	wGen.milliHz				= wGen.frequency * 1000;
+	solverFind(wGen.milliHz, &timing);							// The default is always reachable
+	wGen.currentBufSize			= timing.samples;
+	wGen.actualMilliHz			= timing.actualMilliHz;
+	wGen.errorPpb				= timing.errorPpb;
+	wGen.outputMode				= OUTPUT_MODE_TABLE;
+	wGen.ch2Enabled				= 0;
+	wGen.ch2Waveform			= 0;
+	wGen.ch2Phase				= 900;	// Quadrature
+	wGen.amplitude				= DAC_FULL_SCALE;
+	wGen.dcOffset				= 0;
+	wGen.ch2Amplitude			= DAC_FULL_SCALE;
+	wGen.ch2DcOffset			= 0;
+	wGen.bandLimited			= 0;
 	wGen.isPressed 				= 0;
 	wGen.isTransmitting			= 0;
 	wGen.millisStart 			= HAL_GetTick();
@@ -217,6 +304,9 @@ void exitToMain(wGen_HandleTypeDef * wGen){
 		}else if(wGen->currentWaveSelected == 1){
 			SH1106_GotoXY( 5, 53);
 			SH1106_Puts("SQR", &Font_7x10, 1);
+		}else if(wGen->currentWaveSelected == 3){
+			SH1106_GotoXY( 5, 53);
+			SH1106_Puts("ARB", &Font_7x10, 1);
 		}else{
 			SH1106_GotoXY( 2, 53);
 			SH1106_Puts("RAMP", &Font_7x10, 1);
@@ -275,7 +365,7 @@ void exitToMain(wGen_HandleTypeDef * wGen){
 		eraseCursor(wGen);
 		SH1106_DrawTriangle(MAIN_OPTIONS[5]- 4, 45, MAIN_OPTIONS[5] + 4, 45, MAIN_OPTIONS[5], 49, 1);
 		SH1106_DrawFilledRectangle(84, 52, 28, 11, 0);
-		char buf[2];
+		char buf[4];
 		sprintf(buf, "%i", wGen->currentPercent);
 		SH1106_GotoXY(85, 53);
 		SH1106_Puts(buf, &Font_7x10, 1);
@@ -287,74 +377,568 @@ void exitToMain(wGen_HandleTypeDef * wGen){
 	}
 }
 
+// Draws the ARB label and a thumbnail of the user waveform in the picture area
+void arb(wGen_HandleTypeDef * wGen){
+	SH1106_DrawFilledRectangle(2, 52, 28, 11, 0);
+	SH1106_GotoXY(5, 53);
+	SH1106_Puts("ARB", &Font_7x10, 1);
+	wGen->currentWaveSelected = 3;
+	wGen->currentPercent = 50;
+	wGen->dutyTenths = 500;
+	SH1106_DrawFilledRectangle(2, 0, 80, 40, 0);
+	for(uint8_t x = 0; x < 80; x++){
+		uint16_t code = arbTable[(uint32_t)x * arbSize / 80];
+		SH1106_DrawPixel(2 + x, 39 - (code * 39 + RESOLUTION_12BIT / 2) / (RESOLUTION_12BIT - 1), 1);
+	}
+	SH1106_DrawFilledRectangle(84, 52, 28, 11, 0);
+	SH1106_DrawFilledRectangle(84, 30, 34, 11, 0);
+}
+
 void getSamples(wGen_HandleTypeDef * wGen){
 	uint16_t lastSamples = samples;
-	if(wGen->frequency < 251){
-			samples = TX_BUF_SIZE_MAX_250_HZ;
-		}else if(wGen->frequency < 501){
-			samples = TX_BUF_SIZE_MAX_500_HZ;
-		}else if(wGen->frequency <= 5000){
-			samples = TX_BUF_SIZE_MAX_5000_HZ;
-		}else if(wGen->frequency <= 10000){
-			samples = TX_BUF_SIZE_MAX_10000_HZ;
-		}else if(wGen->frequency <= 20000){
-			samples = TX_BUF_SIZE_MAX_20000_HZ;
-		}else if(wGen->frequency <= 100000){
-			samples = TX_BUF_SIZE_MAX_100000_HZ;
-		}else if(wGen->frequency <= 200000){
-			samples = TX_BUF_SIZE_MAX_200000_HZ;
-		}else{
-			samples = TX_BUF_SIZE_MAX_999000_HZ;
+	ddsEnabled = (wGen->outputMode == OUTPUT_MODE_DDS);
+	if(ddsEnabled){
+		// The buffer size never changes in DDS mode; only the tuning word follows the frequency.  Above
+		// DDS_MAX_MILLIHZ a cycle has too few samples to be usable, so the front panel is held there
+		if(wGen->milliHz > DDS_MAX_MILLIHZ){
+			wGen->milliHz	= DDS_MAX_MILLIHZ;
+			wGen->frequency	= DDS_MAX_MILLIHZ / 1000;
 		}
-		wGen->currentBufSize = samples;
+		samples = DDS_BUF_SIZE;
+		publishDds(wGen);
+		wGen->actualMilliHz	= ddsActualMilliHz(ddsNext.tuningWord);
+		wGen->errorPpb		= ddsErrorPpb(wGen->milliHz, ddsNext.tuningWord);
+	}else if(solverFind(wGen->milliHz, &tableTiming)){
+		// Samples per cycle is chosen together with PSC / ARR; an unreachable frequency keeps the last settings
+		samples = tableTiming.samples;
+		wGen->actualMilliHz	= tableTiming.actualMilliHz;
+		wGen->errorPpb		= tableTiming.errorPpb;
+	}
+	wGen->currentBufSize = samples;
 	if(lastSamples != samples){
-		switch(wGen->currentWaveSelected){
-		case 0:
-			getSineVal(wGen);
-			break;
+		getWaveVal(wGen);
+	}
+}
 
-		case 1:
-			getSquareVal(wGen);
-			break;
+static void getWaveVal(wGen_HandleTypeDef * wGen){
+	activeBuf = TX_Bits;
+	switch(wGen->currentWaveSelected){
+	case 0:
+		getSineVal(wGen);
+		break;
 
-		case 2:
-			getRampVal(wGen);
-			break;
+	case 1:
+		getSquareVal(wGen);
+		break;
 
-		default:
-			getSineVal(wGen);
+	case 2:
+		getRampVal(wGen);
+		break;
+
+	case 3:
+		getArbVal(wGen);
+		break;
+
+	default:
+		getSineVal(wGen);
+	}
+	if(!ddsEnabled && wGen->ch2Enabled){
+		fillChannel2(wGen);
+	}
+}
+
+// Fills one cycle of a waveform into a table-path buffer
+static void fillTable(wGen_HandleTypeDef * wGen, uint16_t * buf, uint8_t waveform){
+	switch(waveform){
+	case 1:
+		if(wGen->bandLimited){
+			synthSquareBlep(buf, samples, wGen->dutyTenths);
+		}else{
+			synthSquare(buf, samples, wGen->dutyTenths);
+		}
+		break;
+
+	case 2:
+		if(wGen->bandLimited){
+			synthRampBlamp(buf, samples, wGen->dutyTenths);
+		}else{
+			synthRamp(buf, samples, wGen->dutyTenths);
+		}
+		break;
+
+	case 3:
+		synthDecimate(buf, samples, arbTable, arbSize);
+		break;
+
+	default:
+		// Sizes that divide the flash master table are a strided copy; the rest go through the CORDIC
+		if(DDS_TABLE_SIZE % samples == 0){
+			synthDecimate(buf, samples, SINE_master, DDS_TABLE_SIZE);
+		}else{
+			synthSine(buf, samples);
 		}
 	}
 }
 
-void getRampVal(wGen_HandleTypeDef * wGen){
-	uint16_t rampUpDivs =   round(wGen->currentPercent * samples / 100) ;
-	uint16_t rampDownDivs = samples - rampUpDivs;
-	float divSize = 4095 / rampUpDivs;
-	float accumulator = 0;
-	int i;
-	for(i = 0; i < rampUpDivs; i++){
-		accumulator += divSize;
-		TX_Bits[i] = round(accumulator);
+// CH1's table-path cycle, generated at full scale into TX_Raw and leveled into TX_Bits
+static void fillChannel1(wGen_HandleTypeDef * wGen, uint8_t waveform){
+	uint32_t start = profileStart();
+	fillTable(wGen, TX_Raw, waveform);
+	synthApplyLevel(TX_Raw, TX_Bits, samples, synthLevel(wGen->amplitude, wGen->dcOffset));
+	dmaBufferClean(TX_Bits, samples * sizeof(uint16_t));
+	profileStop(PROFILE_SYNTH, start);
+}
+
+// CH2's table-path cycle: its own waveform, rotated so that it leads CH1 by ch2Phase to the nearest sample
+static void fillChannel2(wGen_HandleTypeDef * wGen){
+	fillTable(wGen, TX_Raw2, wGen->ch2Waveform);
+	synthRotate(TX_Raw2, samples, (((uint32_t)wGen->ch2Phase * samples + 1800) / 3600) % samples);
+	synthApplyLevel(TX_Raw2, TX_Bits2, samples, synthLevel(wGen->ch2Amplitude, wGen->ch2DcOffset));
+	dmaBufferClean(TX_Bits2, samples * sizeof(uint16_t));
+}
+
+void getArbVal(wGen_HandleTypeDef * wGen){
+	if(ddsEnabled){
+		publishDds(wGen);
+		return;
 	}
+	fillChannel1(wGen, 3);
+}
 
-	divSize = 4095 / rampDownDivs;
-	accumulator = RESOLUTION_12BIT - 1;
-	for(i = rampUpDivs; i < samples; i++){
-		accumulator -= divSize;
-		TX_Bits[i] = round(accumulator);
+void getRampVal(wGen_HandleTypeDef * wGen){
+	if(ddsEnabled){
+		publishDds(wGen);
+		return;
 	}
+	fillChannel1(wGen, 2);
 }
 
 void getSquareVal(wGen_HandleTypeDef * wGen){
-	for(int i = 0; i < samples; i++){
-		TX_Bits[i] = ((float)wGen->currentPercent/100 * samples < i ? 0 : RESOLUTION_12BIT - 1);
+	if(ddsEnabled){
+		publishDds(wGen);
+		return;
 	}
+	fillChannel1(wGen, 1);
 }
 
 void getSineVal(wGen_HandleTypeDef * wGen){
-	for(int i = 0; i < samples; i++){
-		TX_Bits[i] = ((sin(i * 2 * pi / samples) + 1)) * RESOLUTION_12BIT / 2;
+	if(ddsEnabled){
+		publishDds(wGen);
+		return;
+	}
+	fillChannel1(wGen, 0);
+}
+
+// Sets up the DDS engine and TIM6 for the sample rate the output mode needs.  Call once after wGen_create()
+void initOutput(wGen_HandleTypeDef * wGen){
+	cordicInit();
+	dds = dds_create(SINE_master);
+	dds2 = dds_create(SINE_master);
+	sweep = sweep_create();
+	modulation = mod_create(SINE_master);
+	waveCache = waveCache_create(&cacheBuffers[0][0], MAX_SAMPLES_PER_REV);
+	mdmaFill = mdmaFill_create(MDMA_Channel0);
+	mdmaFillInit(&mdmaFill);
+	samples = 0;
+	getSamples(wGen);
+	if(wGen->outputMode == OUTPUT_MODE_DDS){
+		setTimerRate(DDS_TIM6_PRESCALER, DDS_TIM6_PERIOD);
+	}else{
+		setTimerRate(tableTiming.prescaler, tableTiming.period);
+	}
+}
+
+// Loads the current waveform settings into the DDS engine and fills the whole buffer ahead of a DMA start
+static void primeDds(wGen_HandleTypeDef * wGen){
+	publishDds(wGen);
+	ddsLoadSettings(&dds, &ddsNext);
+	ddsLoadSettings(&dds2, &dds2Next);
+	ch2Offset = ch2OffsetNext;
+	ch1Level = ch1LevelNext;
+	ch2Level = ch2LevelNext;
+	ddsUpdatePending = 0;
+	fillBlock(0, DDS_BUF_SIZE);
+}
+
+// Stages the waveform, duty and frequency for the refill callbacks.  The pending flag is dropped while ddsNext is
+// rewritten, so a refill that interrupts us simply keeps the old settings for one more half-buffer
+static void publishDds(wGen_HandleTypeDef * wGen){
+	ddsUpdatePending = 0;
+	__DMB();
+	ddsNext.waveform = wGen->currentWaveSelected;
+	ddsNext.arbTable = arbTable;
+	ddsNext.arbSize	 = arbSize;
+	ddsSetDuty(&ddsNext, wGen->dutyTenths);
+	ddsSetFrequency(&ddsNext, wGen->milliHz);
+	dds2Next = ddsNext;
+	dds2Next.waveform = wGen->ch2Waveform;
+	ch2OffsetNext = (uint32_t)(((uint64_t)wGen->ch2Phase << 32) / 3600);
+	ch1LevelNext = synthLevel(wGen->amplitude, wGen->dcOffset);
+	ch2LevelNext = synthLevel(wGen->ch2Amplitude, wGen->ch2DcOffset);
+	__DMB();
+	ddsUpdatePending = 1;
+}
+
+// Moves settings staged by publishDds() into the engines.  Runs from the refill, or with interrupts masked
+static void applyDds(void){
+	if(ddsUpdatePending){
+		ddsLoadSettings(&dds, &ddsNext);
+		ddsLoadSettings(&dds2, &dds2Next);
+		ch2Offset = ch2OffsetNext;
+		ch1Level = ch1LevelNext;
+		ch2Level = ch2LevelNext;
+		ddsUpdatePending = 0;
+	}
+}
+
+// Applies any staged settings, fills one half of the buffers and checks that DMA has not already come back to it
+static void refillHalf(uint8_t secondHalf){
+	applyDds();
+	if(sweep.active){
+		dds.tuningWord = sweepNext(&sweep);
+	}
+	fillBlock(secondHalf ? DDS_BUF_SIZE / 2 : 0, DDS_BUF_SIZE / 2);
+
+	uint16_t readPos = DDS_BUF_SIZE - __HAL_DMA_GET_COUNTER(&hdma_dac1_ch1);
+	if((readPos >= DDS_BUF_SIZE / 2) == secondHalf){
+		refillMisses++;
+	}
+}
+
+// Fills both channels from the same block start.  With modulation on the block is filled MOD_BLOCK samples at a
+// time, each with its own LFO step; the carrier word (a sweep's included) is put back afterwards
+static void fillBlock(uint16_t start, uint16_t count){
+	uint32_t cycles = profileStart();
+	if(modulation.active){
+		uint32_t carrier = dds.tuningWord;
+		for(uint16_t i = 0; i < count; i += MOD_BLOCK){
+			int32_t lfo = modStep(&modulation, &dds, carrier);
+			fillSpan(start + i, MOD_BLOCK, modLevel(&modulation, ch1Level, lfo), modLevel(&modulation, ch2Level, lfo));
+		}
+		dds.tuningWord = carrier;
+	}else{
+		fillSpan(start, count, ch1Level, ch2Level);
+	}
+	if(ch2Active){
+		dmaBufferClean(&TX_Bits2[start], count * sizeof(uint16_t));
+	}
+	dmaBufferClean(&TX_Bits[start], count * sizeof(uint16_t));
+	profileStop(PROFILE_SYNTH, cycles);
+}
+
+// CH2 takes CH1's phase plus the offset and CH1's tuning word (sweeps and modulation included) every time, so the
+// phase relationship holds exactly however the settings change.  The engines write full scale and each span is
+// then leveled in place
+static void fillSpan(uint16_t start, uint16_t count, Synth_LevelTypeDef level1, Synth_LevelTypeDef level2){
+	if(ch2Active){
+		dds2.phase		= dds.phase + ch2Offset;
+		dds2.tuningWord	= dds.tuningWord;
+		ddsFill(&dds2, &TX_Bits2[start], count);
+		synthApplyLevel(&TX_Bits2[start], &TX_Bits2[start], count, level2);
+	}
+	ddsFill(&dds, &TX_Bits[start], count);
+	synthApplyLevel(&TX_Bits[start], &TX_Bits[start], count, level1);
+}
+
+// Starts DMA on CH1, and CH2 if enabled, with TIM6 held so both channels take their first sample on the same
+// trigger; from then on the shared TRGO keeps them in step
+static void startOutput(void){
+	__HAL_TIM_DISABLE(&htim6);
+	if(ddsEnabled){
+		activeBuf = TX_Bits;
+	}
+	HAL_DAC_Start_DMA(&hdac1, DAC_CHANNEL_1, (uint32_t *)activeBuf, samples, DAC_ALIGN_12B_R);
+	if(ch2Active){
+		HAL_DAC_Start_DMA(&hdac1, DAC_CHANNEL_2, (uint32_t *)TX_Bits2, samples, DAC_ALIGN_12B_R);
+	}else if(!ddsEnabled){
+		enableBufferSwap();
+	}
+	__HAL_TIM_SET_COUNTER(&htim6, 0);
+	__HAL_TIM_ENABLE(&htim6);
+}
+
+static void stopOutput(void){
+	patchPending = 0;
+	if(swapPending){
+		activeBuf	= pendingBuf;
+		swapPending	= 0;
+	}
+	HAL_DAC_Stop_DMA(&hdac1, DAC_CHANNEL_1);
+	if(hdac1.DMA_Handle2->State == HAL_DMA_STATE_BUSY){
+		HAL_DAC_Stop_DMA(&hdac1, DAC_CHANNEL_2);
+	}
+}
+
+// Puts new waveform or duty settings on the output.  In DDS mode the DAC keeps running and the change lands on the
+// next half-buffer boundary.  The table path swaps to a cached cycle if there is one, otherwise it has to stop DMA
+// and rebuild its single cycle
+static void refreshOutput(wGen_HandleTypeDef * wGen){
+	if(ddsEnabled){
+		publishDds(wGen);
+		return;
+	}
+	if(switchFromCache(wGen)){
+		return;
+	}
+	stopOutput();
+	getWaveVal(wGen);
+	startOutput();
+}
+
+// Moves a live table-path square's falling edge by rewriting only the samples between the old and new edge, rather
+// than regenerating and restarting.  Returns 0 when the output has to go through refreshOutput() instead
+static uint8_t patchDuty(wGen_HandleTypeDef * wGen, uint16_t oldTenths){
+	if(ddsEnabled || wGen->currentWaveSelected != 1 || wGen->bandLimited || wGen->ch2Enabled || patchPending
+			|| activeBuf != TX_Bits || swapPending){
+		return 0;
+	}
+	uint32_t from	= synthDutyEdge(samples, oldTenths);
+	uint32_t to		= synthDutyEdge(samples, wGen->dutyTenths);
+	if(from == to){
+		return 1;
+	}
+	// Every sample from the one holding the earlier edge to the one holding the later edge
+	patchStart	= (to > from ? from : to) >> 16;
+	patchEnd	= ((to > from ? to : from) >> 16) + 1;
+	if(patchEnd > samples){
+		patchEnd = samples;
+	}
+	patchTenths	= wGen->dutyTenths;
+	patchLevel	= synthLevel(wGen->amplitude, wGen->dcOffset);
+
+	__disable_irq();
+	uint8_t done = applyPatch();
+	if(!done){
+		patchPending = 1;			// Retried from the DMA half / complete callbacks
+	}
+	__enable_irq();
+	return 1;
+}
+
+// Writes the staged patch if DMA is outside it and far enough away not to catch up with the writes, so every cycle
+// DMA plays has exactly one falling edge.  Called with the DMA callbacks masked or from one of them
+static uint8_t applyPatch(void){
+	uint16_t readPos	= samples - __HAL_DMA_GET_COUNTER(&hdma_dac1_ch1);
+	uint16_t length		= patchEnd - patchStart;
+	if(readPos >= patchStart && readPos < patchEnd){
+		return 0;
+	}
+	// DMA takes at least SOLVER_MIN_TICKS timer clocks (52 CPU clocks) per sample, several times the cost of a write
+	uint16_t ahead = (patchStart + samples - readPos) % samples;
+	if(ahead < length / 4 + 8){
+		return 0;
+	}
+
+	synthSquareSpan(TX_Raw, samples, patchTenths, patchStart, patchEnd);
+	synthApplyLevel(&TX_Raw[patchStart], &TX_Bits[patchStart], length, patchLevel);
+	dmaBufferClean(&TX_Bits[patchStart], length * sizeof(uint16_t));
+	return 1;
+}
+
+// Cache key for waveform at the current samples per cycle, duty and CH1 level
+static WaveCache_KeyTypeDef cacheKey(wGen_HandleTypeDef * wGen, uint8_t waveform){
+	WaveCache_KeyTypeDef key;
+	uint8_t hasDuty = (waveform == 1 || waveform == 2);
+	key.waveform	= waveform;
+	key.bandLimited	= (hasDuty ? wGen->bandLimited : 0);
+	key.samples		= samples;
+	key.dutyTenths	= (hasDuty ? wGen->dutyTenths : 0);
+	key.level		= synthLevel(wGen->amplitude, wGen->dcOffset);
+	key.arbSerial	= (waveform == 3 ? arbSerial : 0);
+	return key;
+}
+
+// Table path, CH1 only: if the current settings' cycle is cached, has DMA switch to it at the next cycle boundary
+// instead of stopping and rebuilding.  Returns 0 on a miss
+static uint8_t switchFromCache(wGen_HandleTypeDef * wGen){
+	if(wGen->ch2Enabled || !wGen->isTransmitting){
+		return 0;
+	}
+	WaveCache_KeyTypeDef key = cacheKey(wGen, wGen->currentWaveSelected);
+	uint16_t * buf = waveCacheFind(&waveCache, &key);
+	if(buf == NULL){
+		return 0;
+	}
+	__disable_irq();
+	if(buf != activeBuf || swapPending){
+		pendingBuf	= buf;
+		swapPending	= 1;
+		advanceSwap();				// Otherwise the next DMA callback does it
+	}
+	__enable_irq();
+	return 1;
+}
+
+// Puts the CH1 stream into double-buffer mode with both memory pointers on activeBuf, so advanceSwap() can move it
+// to another buffer at a cycle boundary.  Called from startOutput() while TIM6 is held, before any sample has gone
+static void enableBufferSwap(void){
+	DMA_Stream_TypeDef * stream = (DMA_Stream_TypeDef *)hdma_dac1_ch1.Instance;
+
+	__disable_irq();
+	__HAL_DMA_DISABLE(&hdma_dac1_ch1);
+	while(stream->CR & DMA_SxCR_EN);
+	__HAL_DMA_CLEAR_FLAG(&hdma_dac1_ch1, __HAL_DMA_GET_TC_FLAG_INDEX(&hdma_dac1_ch1)
+			| __HAL_DMA_GET_HT_FLAG_INDEX(&hdma_dac1_ch1) | __HAL_DMA_GET_TE_FLAG_INDEX(&hdma_dac1_ch1)
+			| __HAL_DMA_GET_FE_FLAG_INDEX(&hdma_dac1_ch1) | __HAL_DMA_GET_DME_FLAG_INDEX(&hdma_dac1_ch1));
+	stream->NDTR	= samples;
+	stream->M0AR	= (uint32_t)activeBuf;
+	stream->M1AR	= (uint32_t)activeBuf;
+	stream->CR		= (stream->CR & ~DMA_SxCR_CT) | DMA_SxCR_DBM;
+
+	// The DAC only hooks the memory 0 callbacks; memory 1 passes are the same buffer as far as it is concerned
+	hdma_dac1_ch1.XferM1CpltCallback		= hdma_dac1_ch1.XferCpltCallback;
+	hdma_dac1_ch1.XferM1HalfCpltCallback	= hdma_dac1_ch1.XferHalfCpltCallback;
+	__HAL_DMA_ENABLE(&hdma_dac1_ch1);
+	__enable_irq();
+}
+
+// Points the idle DMA memory register at pendingBuf.  Once the register in use also holds it, DMA has crossed the
+// boundary onto the new cycle and the swap is done.  Writing the register in use is a transfer error, so nothing is
+// touched within a few samples of a boundary, where the registers are about to change roles; the next DMA callback
+// retries.  Runs in a DMA callback or with interrupts off
+static void advanceSwap(void){
+	DMA_Stream_TypeDef * stream = (DMA_Stream_TypeDef *)hdma_dac1_ch1.Instance;
+
+	// DMA takes at least SOLVER_MIN_TICKS timer clocks (52 CPU clocks) per sample
+	if(__HAL_DMA_GET_COUNTER(&hdma_dac1_ch1) < 8){
+		return;
+	}
+	uint32_t playing;
+	if(stream->CR & DMA_SxCR_CT){
+		playing			= stream->M1AR;
+		stream->M0AR	= (uint32_t)pendingBuf;
+	}else{
+		playing			= stream->M0AR;
+		stream->M1AR	= (uint32_t)pendingBuf;
+	}
+	if(playing == (uint32_t)pendingBuf){
+		activeBuf	= pendingBuf;
+		swapPending	= 0;
+	}
+}
+
+// Builds at most one missing cache entry per call; run from the main loop.  The candidates are every waveform at
+// the current frequency, duty and level, so the next waveform change is a pointer swap rather than a rebuild.
+// Entries the MDMA can build are started here and committed on a later call once it is done
+void cacheUpdate(wGen_HandleTypeDef * wGen){
+	if(mdmaSlot != NULL){
+		if(!mdmaFillDone(&mdmaFill)){
+			return;
+		}
+		finishMdmaSlot();
+	}
+	if(ddsEnabled || wGen->ch2Enabled){
+		return;
+	}
+	for(uint8_t waveform = 0; waveform < 4; waveform++){
+		WaveCache_KeyTypeDef key = cacheKey(wGen, waveform);
+		if(waveCacheContains(&waveCache, &key)){
+			continue;
+		}
+		uint16_t * buf = waveCacheClaim(&waveCache, &key, activeBuf, pendingBuf);
+		if(buf == NULL || startMdmaSlot(buf, &key)){
+			return;
+		}
+		fillTable(wGen, buf, waveform);
+		synthApplyLevel(buf, buf, samples, key.level);
+		dmaBufferClean(buf, samples * sizeof(uint16_t));
+		waveCacheCommit(&waveCache, buf);
+		return;
+	}
+}
+
+// Hands a cache slot fill to the MDMA when the cycle is a plain copy or fill: a sine or ARB cycle that divides
+// its source table, or a square without band limiting.  Returns 0 for the CPU to build it instead
+static uint8_t startMdmaSlot(uint16_t * buf, const WaveCache_KeyTypeDef * key){
+	uint8_t started = 0;
+	switch(key->waveform){
+	case 0:
+		if(DDS_TABLE_SIZE % key->samples == 0){
+			started = mdmaFillCopy(&mdmaFill, buf, SINE_master, key->samples, DDS_TABLE_SIZE / key->samples);
+		}
+		break;
+
+	case 1:
+		if(!key->bandLimited){
+			// Leveled high and low, so only the edge sample is left for the CPU
+			uint16_t levels[2] = { SYNTH_FULL_SCALE, 0 };
+			synthApplyLevel(levels, levels, 2, key->level);
+			started = mdmaFillSquare(&mdmaFill, buf, key->samples, synthDutyEdge(key->samples, key->dutyTenths) >> 16,
+					levels[0], levels[1]);
+		}
+		break;
+
+	case 3:
+		if(arbSize >= key->samples && arbSize % key->samples == 0){
+			started = mdmaFillCopy(&mdmaFill, buf, arbTable, key->samples, arbSize / key->samples);
+		}
+		break;
+	}
+	if(started){
+		mdmaSlot	= buf;
+		mdmaKey		= *key;
+	}
+	return started;
+}
+
+// The MDMA has filled mdmaSlot.  Finishes what it cannot do on the CPU and commits the slot; after a bus error
+// the slot is left invalid for the next claim
+static void finishMdmaSlot(void){
+	uint16_t * buf	= mdmaSlot;
+	mdmaSlot		= NULL;
+	if(mdmaFill.failed){
+		return;
+	}
+	if(mdmaKey.waveform == 1){
+		uint16_t edge = synthDutyEdge(mdmaKey.samples, mdmaKey.dutyTenths) >> 16;
+		if(edge < mdmaKey.samples){
+			synthSquareSpan(buf, mdmaKey.samples, mdmaKey.dutyTenths, edge, edge + 1);
+			synthApplyLevel(&buf[edge], &buf[edge], 1, mdmaKey.level);
+		}
+	}else{
+		synthApplyLevel(buf, buf, mdmaKey.samples, mdmaKey.level);
+	}
+	dmaBufferClean(buf, mdmaKey.samples * sizeof(uint16_t));
+	waveCacheCommit(&waveCache, buf);
+}
+
+uint32_t getCacheHits(void){
+	return waveCache.hits;
+}
+
+uint32_t getCacheMisses(void){
+	return waveCache.misses;
+}
+
+uint32_t getRefillMisses(void){
+	return refillMisses;
+}
+
+// DMA has finished the first half of TX_Bits and is playing the second, so the first half is free to refill
+void HAL_DAC_ConvHalfCpltCallbackCh1(DAC_HandleTypeDef * hdac){
+	if(ddsEnabled){
+		refillHalf(0);
+		return;
+	}
+	if(swapPending){
+		advanceSwap();
+	}
+	if(patchPending && applyPatch()){
+		patchPending = 0;
+	}
+}
+
+// DMA has wrapped back to the start of TX_Bits; refill the second half
+void HAL_DAC_ConvCpltCallbackCh1(DAC_HandleTypeDef * hdac){
+	if(ddsEnabled){
+		refillHalf(1);
+		return;
+	}
+	if(swapPending){
+		advanceSwap();
+	}
+	if(patchPending && applyPatch()){
+		patchPending = 0;
 	}
 }
 
@@ -398,7 +982,8 @@ void ramp(wGen_HandleTypeDef * wGen){
 	SH1106_Puts("RAMP", &Font_7x10, 0);
 	wGen->currentWaveSelected = 2;
 	wGen->currentPercent = 50;
-	SH1106_DrawBitmap(2, 0, ramp50, 80, 40, 1);
+	wGen->dutyTenths = 500;
+	SH1106_DrawSprite(2, 0, ramp50, 80, 40, 1);
 	SH1106_DrawFilledRectangle(84, 52, 28, 11, 0);
 	SH1106_DrawFilledRectangle(84, 30, 34, 11, 0);
 	SH1106_GotoXY(85, 53);
@@ -465,7 +1050,7 @@ void selectUnits(wGen_HandleTypeDef * wGen){
 void selectPercent(wGen_HandleTypeDef * wGen){
 	SH1106_DrawFilledTriangle(MAIN_OPTIONS[5] - 4, 45, MAIN_OPTIONS[5] + 4, 45, MAIN_OPTIONS[5], 49, 1);
 	SH1106_DrawFilledRectangle(84, 52, 28, 11, 1);
-	char buf[2];
+	char buf[4];
 	sprintf(buf, "%i", wGen->currentPercent);
 	SH1106_GotoXY(85, 53);
 	SH1106_Puts(buf, &Font_7x10, 0);
@@ -482,15 +1067,18 @@ void selectTransmit(wGen_HandleTypeDef * wGen){
 		SH1106_DrawFilledRectangle(90, 14, 20, 11, 0);
 		SH1106_GotoXY( 90 , 15);
 		SH1106_Puts("TX!", &Font_7x10, 1);
-		SH1106_DrawBitmap(115, 15, TX_Icon, 10, 10, 1);
-		HAL_DAC_Start_DMA(&hdac1, DAC_CHANNEL_1, TX_Bits, samples, DAC_ALIGN_12B_R);
+		SH1106_DrawSprite(115, 15, TX_Icon, 10, 10, 1);
+		if(ddsEnabled){
+			primeDds(wGen);
+		}
+		startOutput();
 
 	}else{
 		SH1106_DrawFilledRectangle(90, 14, 20, 11, 0);
 		SH1106_GotoXY( 90 , 15);
 		SH1106_Puts("TX:", &Font_7x10, 1);
 		SH1106_DrawFilledRectangle(115, 15, 10, 10, 0);
-		HAL_DAC_Stop_DMA(&hdac1, DAC_CHANNEL_1);
+		stopOutput();
 	}
 
 	SH1106_UpdateScreen();
@@ -509,9 +1097,7 @@ void selectWaveform(wGen_HandleTypeDef * wGen){
 			wGen->menuMode = 1;
 			SH1106_UpdateScreen();
 			if(wGen->isTransmitting){
-				HAL_DAC_Stop_DMA(&hdac1, DAC_CHANNEL_1);
-				getSineVal(wGen);
-				HAL_DAC_Start_DMA(&hdac1, DAC_CHANNEL_1, TX_Bits, samples, DAC_ALIGN_12B_R);
+				refreshOutput(wGen);
 			}
 			break;
 
@@ -523,13 +1109,20 @@ void selectWaveform(wGen_HandleTypeDef * wGen){
 			wGen->menuMode = 1;
 			SH1106_UpdateScreen();
 			if(wGen->isTransmitting){
-				HAL_DAC_Stop_DMA(&hdac1, DAC_CHANNEL_1);
-				getSquareVal(wGen);
-				HAL_DAC_Start_DMA(&hdac1, DAC_CHANNEL_1, TX_Bits, samples, DAC_ALIGN_12B_R);
+				refreshOutput(wGen);
 			}
 			getSquareVal(wGen);
 			break;
 
+		case 3:				// ARB
+			wGen->counter = 0x3F6C;
+			SH1106_DrawFilledRectangle(2, 52, 28, 11, 1);
+			SH1106_GotoXY( 5, 53);
+			SH1106_Puts("ARB", &Font_7x10, 0);
+			wGen->menuMode = 1;
+			SH1106_UpdateScreen();
+			break;
+
 		case 2:				// RAMP
 			wGen->counter = 0x3F70;
 			SH1106_DrawFilledRectangle(2, 52, 28, 11, 1);
@@ -538,9 +1131,7 @@ void selectWaveform(wGen_HandleTypeDef * wGen){
 			wGen->menuMode = 1;
 			SH1106_UpdateScreen();
 			if(wGen->isTransmitting){
-				HAL_DAC_Stop_DMA(&hdac1, DAC_CHANNEL_1);
-				getRampVal(wGen);
-				HAL_DAC_Start_DMA(&hdac1, DAC_CHANNEL_1, TX_Bits, samples, DAC_ALIGN_12B_R);
+				refreshOutput(wGen);
 			}
 			break;
 
@@ -556,12 +1147,293 @@ void selectWaveform(wGen_HandleTypeDef * wGen){
 	}
 }
 
+// Switches between the fixed-rate DDS path and the one-cycle-per-buffer table path
+void setOutputMode(wGen_HandleTypeDef * wGen, uint8_t mode){
+	if(wGen->outputMode == mode){
+		return;
+	}
+	if(wGen->isTransmitting){
+		stopOutput();
+	}
+	wGen->outputMode = mode;
+	if(mode == OUTPUT_MODE_DDS){
+		setTimerRate(DDS_TIM6_PRESCALER, DDS_TIM6_PERIOD);
+		getSamples(wGen);
+		primeDds(wGen);
+	}else{
+		getSamples(wGen);
+		setTimerRate(tableTiming.prescaler, tableTiming.period);
+	}
+	if(wGen->isTransmitting){
+		startOutput();
+	}
+}
+
+// Configures DAC1 CH2 (PA5): on/off, its waveform (same numbering as currentWaveSelected) and its phase lead over
+// CH1 in tenths of a degree.  CH2 shares the frequency and duty.  In the table path the offset is rounded to whole
+// samples; in DDS mode it is exact to 2^-32 of a cycle
+void setChannel2(wGen_HandleTypeDef * wGen, uint8_t enabled, uint8_t waveform, uint16_t phase){
+	wGen->ch2Waveform	= waveform;
+	wGen->ch2Phase		= phase % 3600;
+	if(enabled != wGen->ch2Enabled){
+		// Adding or removing a DMA stream needs both restarted together to keep them in step
+		if(wGen->isTransmitting){
+			stopOutput();
+		}
+		wGen->ch2Enabled	= enabled;
+		ch2Active			= enabled;
+		if(ddsEnabled){
+			primeDds(wGen);
+		}else{
+			getWaveVal(wGen);
+		}
+		if(wGen->isTransmitting){
+			startOutput();
+		}
+	}else if(wGen->isTransmitting){
+		refreshOutput(wGen);
+	}else if(ddsEnabled){
+		publishDds(wGen);
+	}else{
+		getWaveVal(wGen);
+	}
+}
+
+// Sets the duty (square) or symmetry (ramp) in 0.1% steps, DUTY_MIN_TENTHS to DUTY_MAX_TENTHS.  Edges and corners
+// are placed to a fraction of a sample, so the setting holds even with only 10 to 50 samples per cycle.  The
+// encoder still moves in 10% steps; currentPercent is the rounded value for the display and sprites
+void setDuty(wGen_HandleTypeDef * wGen, uint16_t tenths){
+	if(tenths < DUTY_MIN_TENTHS){
+		tenths = DUTY_MIN_TENTHS;
+	}else if(tenths > DUTY_MAX_TENTHS){
+		tenths = DUTY_MAX_TENTHS;
+	}
+	uint16_t oldTenths		= wGen->dutyTenths;
+	wGen->dutyTenths		= tenths;
+	wGen->currentPercent	= (tenths + 5) / 10;
+
+	if(wGen->currentWaveSelected == 0){		// Duty / symmetry only affect SQR and RAMP
+		return;
+	}
+	if(!wGen->isTransmitting){
+		getWaveVal(wGen);
+	}else if(!patchDuty(wGen, oldTenths)){
+		refreshOutput(wGen);
+	}
+}
+
+// Switches the table path's square and ramp between naive edges and band-limited (BLEP / BLAMP) edges.  The
+// band-limited square swings over slightly less than full scale to leave room for its ringing.  DDS output is
+// unaffected
+void setBandLimited(wGen_HandleTypeDef * wGen, uint8_t enabled){
+	wGen->bandLimited = enabled;
+	if(ddsEnabled){
+		return;
+	}
+	if(wGen->isTransmitting){
+		refreshOutput(wGen);
+	}else{
+		getWaveVal(wGen);
+	}
+}
+
+// Sets a channel's (1 or 2) peak-to-peak amplitude and DC offset from mid-scale, both in DAC codes; see
+// DAC_MV_TO_CODES.  Only the leveling stage changes: DDS picks the new level up at the next half-buffer and the
+// table path re-levels its stored full-scale cycle in place, so nothing is regenerated and DMA keeps running
+void setLevel(wGen_HandleTypeDef * wGen, uint8_t channel, uint16_t amplitude, int16_t offset){
+	if(amplitude > DAC_FULL_SCALE){
+		amplitude = DAC_FULL_SCALE;
+	}
+	if(channel == 2){
+		wGen->ch2Amplitude	= amplitude;
+		wGen->ch2DcOffset	= offset;
+	}else{
+		wGen->amplitude		= amplitude;
+		wGen->dcOffset		= offset;
+	}
+
+	if(ddsEnabled){
+		publishDds(wGen);
+	}else if(channel == 2){
+		if(wGen->ch2Enabled){
+			synthApplyLevel(TX_Raw2, TX_Bits2, samples, synthLevel(amplitude, offset));
+			dmaBufferClean(TX_Bits2, samples * sizeof(uint16_t));
+		}
+	}else if(activeBuf != TX_Bits || swapPending){
+		// A cached cycle is playing and TX_Raw does not hold it
+		if(wGen->isTransmitting){
+			refreshOutput(wGen);
+		}else{
+			getWaveVal(wGen);
+		}
+	}else{
+		synthApplyLevel(TX_Raw, TX_Bits, samples, synthLevel(amplitude, offset));
+		dmaBufferClean(TX_Bits, samples * sizeof(uint16_t));
+	}
+}
+
+// Sets the output frequency in millihertz.  wGen->actualMilliHz and wGen->errorPpb report what the hardware
+// produces; see wgen.h for the accuracy of each output mode.  Returns 0, leaving the output untouched, if the
+// frequency is out of range for the current mode
+uint8_t setFrequencyMilliHz(wGen_HandleTypeDef * wGen, uint32_t milliHz){
+	Solver_ResultTypeDef timing;
+	if(milliHz == 0){
+		return 0;
+	}
+	if(wGen->outputMode == OUTPUT_MODE_DDS){
+		if(milliHz > DDS_MAX_MILLIHZ){
+			return 0;
+		}
+	}else if(!solverFind(milliHz, &timing)){
+		return 0;
+	}
+	wGen->milliHz	= milliHz;
+	wGen->frequency	= milliHz / 1000;			// Front panel digits show whole hertz
+	applyFrequency(wGen);
+	return 1;
+}
+
+// Plays one cycle of a user waveform (12-bit codes, at the current frequency).  In DDS mode the new table is loaded
+// at once, possibly in the middle of a half-buffer, and the previous table is no longer read once this returns
+void loadArbWaveform(wGen_HandleTypeDef * wGen, const uint16_t * table, uint16_t size){
+	arbTable	= table;
+	arbSize		= size;
+	arbSerial++;
+	arb(wGen);
+	if(ddsEnabled){
+		// Load the new table now rather than wait for a refill that a stalled DMA would never run; the caller
+		// reuses the old table's buffer as soon as this returns
+		publishDds(wGen);
+		__disable_irq();
+		applyDds();
+		__enable_irq();
+	}else if(wGen->isTransmitting){
+		refreshOutput(wGen);
+	}else{
+		getArbVal(wGen);
+	}
+	SH1106_UpdateScreen();
+}
+
+// Sweeps the DDS output from startMilliHz to stopMilliHz over durationMs, one step per half-buffer refill
+// (DDS_BUF_SIZE / 2 samples, ~186 us).  Switches to DDS mode if needed.  With repeat set the sweep restarts at
+// the end, otherwise it holds stopMilliHz until stopSweep() or a new frequency; stopMilliHz becomes wGen->milliHz
+// then, so other settings changes keep it too.  Returns 0 for an invalid sweep
+uint8_t startSweep(wGen_HandleTypeDef * wGen, uint32_t startMilliHz, uint32_t stopMilliHz, uint32_t durationMs,
+		uint8_t law, uint8_t repeat){
+	const uint32_t maxMilliHz = DDS_MAX_MILLIHZ;
+	if(startMilliHz > maxMilliHz || stopMilliHz > maxMilliHz){
+		return 0;
+	}
+	uint64_t updates = (uint64_t)durationMs * DDS_SAMPLE_RATE_HZ / (1000UL * (DDS_BUF_SIZE / 2));
+	if(updates > 0xFFFFFFFF){
+		return 0;
+	}
+	sweep.active = 0;
+	__DMB();
+	if(!sweepConfigure(&sweep, ddsTuningWord(startMilliHz), ddsTuningWord(stopMilliHz), (uint32_t)updates, law, repeat)){
+		return 0;
+	}
+	setOutputMode(wGen, OUTPUT_MODE_DDS);
+	__DMB();
+	sweep.active = 1;
+	if(!repeat){
+		// Published after the sweep is running, so the refill that loads it lets the sweep override it
+		sweepReturnMilliHz	= wGen->milliHz;
+		sweepStopMilliHz	= stopMilliHz;
+		wGen->milliHz		= stopMilliHz;
+		wGen->frequency		= stopMilliHz / 1000;
+		getSamples(wGen);
+	}
+	return 1;
+}
+
+// Ends a sweep and returns the output to wGen->milliHz at the next half-buffer boundary.  A one-shot sweep stopped
+// before it ends goes back to the frequency it started from, unless a new one has been set since
+void stopSweep(wGen_HandleTypeDef * wGen){
+	uint8_t early = sweep.active && !sweep.repeat;
+	sweep.active = 0;
+	__DMB();
+	if(early && wGen->milliHz == sweepStopMilliHz){
+		wGen->milliHz	= sweepReturnMilliHz;
+		wGen->frequency	= sweepReturnMilliHz / 1000;
+	}
+	if(ddsEnabled){
+		getSamples(wGen);
+	}
+}
+
+// Modulates the DDS output with the internal LFO.  type is MOD_TYPE_AM, _FM or _PM, shape MOD_SHAPE_SINE, _SQUARE
+// or _RAMP, rateMilliHz the LFO rate (one LFO step per MOD_BLOCK samples, ~86 kHz).  depth is in per mille of the
+// amplitude for AM, peak deviation in mHz for FM and peak deviation in tenths of a degree, below 1800, for PM.  Switches to DDS
+// mode if needed and keeps any sweep running underneath.  AM peaks reach (1 + depth) times the set amplitude, so
+// the amplitude needs that much headroom to avoid clipping.  Returns 0 for settings that cannot be produced
+uint8_t startModulation(wGen_HandleTypeDef * wGen, uint8_t type, uint8_t shape, uint32_t rateMilliHz, uint32_t depth){
+	const uint32_t maxMilliHz = DDS_MAX_MILLIHZ;
+	int32_t nativeDepth;
+	if(rateMilliHz > MOD_MAX_RATE_MILLIHZ){
+		return 0;
+	}
+	switch(type){
+	case MOD_TYPE_AM:
+		if(depth > 1000){
+			return 0;
+		}
+		nativeDepth = (int32_t)((depth << 15) / 1000);
+		break;
+
+	case MOD_TYPE_FM: {
+		// The carrier is the sweep's while one runs, and it can go above wGen->milliHz
+		uint32_t carrier = wGen->milliHz;
+		if(sweep.active){
+			carrier = ddsActualMilliHz(sweep.startWord > sweep.stopWord ? sweep.startWord : sweep.stopWord);
+		}
+		if(depth > maxMilliHz || carrier + depth > maxMilliHz){
+			return 0;
+		}
+		nativeDepth = (int32_t)ddsTuningWord(depth);
+		break;
+	}
+
+	case MOD_TYPE_PM:
+		if(depth >= 1800){
+			return 0;						// 180 degrees is 2^31 phase counts, one past INT32_MAX
+		}
+		nativeDepth = (int32_t)(((uint64_t)depth << 32) / 3600);
+		break;
+
+	default:
+		return 0;
+	}
+	uint32_t lfoStep = (uint32_t)((((uint64_t)rateMilliHz * MOD_BLOCK) << 32) / ((uint64_t)DDS_SAMPLE_RATE_HZ * 1000));
+
+	modulation.active = 0;
+	__DMB();
+	if(!modConfigure(&modulation, type, shape, lfoStep, nativeDepth)){
+		return 0;
+	}
+	setOutputMode(wGen, OUTPUT_MODE_DDS);
+	__DMB();
+	modulation.active = 1;
+	return 1;
+}
+
+// Returns the output to the plain carrier at the next half-buffer refill
+void stopModulation(wGen_HandleTypeDef * wGen){
+	modulation.active = 0;
+	__DMB();
+	if(ddsEnabled){
+		getSamples(wGen);
+	}
+}
+
 void sine(wGen_HandleTypeDef * wGen){
 	SH1106_GotoXY(2, 53);
 	SH1106_Puts("SINE", &Font_7x10, 0);
 	wGen->currentWaveSelected = 0;
-	SH1106_DrawBitmap(2, 0, sinewave, 80, 40, 1);
+	SH1106_DrawSprite(2, 0, sinewave, 80, 40, 1);
 	wGen->currentPercent = 50;
+	wGen->dutyTenths = 500;
 	SH1106_DrawFilledRectangle(84, 52, 28, 11, 0);
 	SH1106_DrawFilledRectangle(84, 30, 30, 11, 0);
 }
@@ -571,7 +1443,8 @@ void square(wGen_HandleTypeDef * wGen){
 	SH1106_Puts("SQR", &Font_7x10, 0);
 	wGen->currentWaveSelected = 1;
 	wGen->currentPercent = 50;
-	SH1106_DrawBitmap(2, 0, square50, 80, 40, 1);
+	wGen->dutyTenths = 500;
+	SH1106_DrawSprite(2, 0, square50, 80, 40, 1);
 	SH1106_DrawFilledRectangle(84, 52, 28, 11, 0);
 	SH1106_DrawFilledRectangle(84, 30, 30, 11, 0);
 	SH1106_GotoXY(85, 30);
@@ -582,86 +1455,93 @@ void square(wGen_HandleTypeDef * wGen){
 
 void updateBitmap(wGen_HandleTypeDef * wGen){
 
+	// Sprites exist for 10% to 90% in 10% steps; finer settings show the nearest one
+	uint8_t sprite = (wGen->dutyTenths + 50) / 100 * 10;
+	if(sprite < 10){
+		sprite = 10;
+	}else if(sprite > 90){
+		sprite = 90;
+	}
 	SH1106_DrawFilledRectangle(2, 0, 80, 40, 0);
-	switch(wGen->currentPercent){
+	switch(sprite){
 
 	case 10:
 		if(wGen->currentWaveSelected == 1){						// Square wave
-			SH1106_DrawBitmap(2, 0, square10, 80, 40, 1);
+			SH1106_DrawSprite(2, 0, square10, 80, 40, 1);
 		}else{
-			SH1106_DrawBitmap(2, 0, ramp10, 80, 40, 1);		// Ramp wave
+			SH1106_DrawSprite(2, 0, ramp10, 80, 40, 1);		// Ramp wave
 		}
 		break;
 
 	case 20:
 		if(wGen->currentWaveSelected == 1){						// Square wave
-			SH1106_DrawBitmap(2, 0, square20, 80, 40, 1);
+			SH1106_DrawSprite(2, 0, square20, 80, 40, 1);
 		}else{
-			SH1106_DrawBitmap(2, 0, ramp20, 80, 40, 1);		// Ramp wave
+			SH1106_DrawSprite(2, 0, ramp20, 80, 40, 1);		// Ramp wave
 		}
 		break;
 
 	case 30:
 		if(wGen->currentWaveSelected == 1){						// Square wave
-			SH1106_DrawBitmap(2, 0, square30, 80, 40, 1);
+			SH1106_DrawSprite(2, 0, square30, 80, 40, 1);
 		}else{
-			SH1106_DrawBitmap(2, 0, ramp30, 80, 40, 1);		// Ramp wave
+			SH1106_DrawSprite(2, 0, ramp30, 80, 40, 1);		// Ramp wave
 		}
 		break;
 
 	case 40:
 		if(wGen->currentWaveSelected == 1){						// Square wave
-			SH1106_DrawBitmap(2, 0, square40, 80, 40, 1);
+			SH1106_DrawSprite(2, 0, square40, 80, 40, 1);
 		}else{
-			SH1106_DrawBitmap(2, 0, ramp40, 80, 40, 1);		// Ramp wave
+			SH1106_DrawSprite(2, 0, ramp40, 80, 40, 1);		// Ramp wave
 		}
 		break;
 
 	case 50:
 		if(wGen->currentWaveSelected == 1){						// Square wave
-			SH1106_DrawBitmap(2, 0, square50, 80, 40, 1);
+			SH1106_DrawSprite(2, 0, square50, 80, 40, 1);
 		}else{
-			SH1106_DrawBitmap(2, 0, ramp50, 80, 40, 1);		// Ramp wave
+			SH1106_DrawSprite(2, 0, ramp50, 80, 40, 1);		// Ramp wave
 		}
 		break;
 
 	case 60:
 		if(wGen->currentWaveSelected == 1){						// Square wave
-			SH1106_DrawBitmap(2, 0, square60, 80, 40, 1);
+			SH1106_DrawSprite(2, 0, square60, 80, 40, 1);
 		}else{
-			SH1106_DrawBitmap(2, 0, ramp60, 80, 40, 1);		// Ramp wave
+			SH1106_DrawSprite(2, 0, ramp60, 80, 40, 1);		// Ramp wave
 		}
 		break;
 
 	case 70:
 		if(wGen->currentWaveSelected == 1){						// Square wave
-			SH1106_DrawBitmap(2, 0, square70, 80, 40, 1);
+			SH1106_DrawSprite(2, 0, square70, 80, 40, 1);
 		}else{
-			SH1106_DrawBitmap(2, 0, ramp70, 80, 40, 1);		// Ramp wave
+			SH1106_DrawSprite(2, 0, ramp70, 80, 40, 1);		// Ramp wave
 		}
 		break;
 
 	case 80:
 		if(wGen->currentWaveSelected == 1){						// Square wave
-			SH1106_DrawBitmap(2, 0, square80, 80, 40, 1);
+			SH1106_DrawSprite(2, 0, square80, 80, 40, 1);
 		}else{
-			SH1106_DrawBitmap(2, 0, ramp80, 80, 40, 1);		// Ramp wave
+			SH1106_DrawSprite(2, 0, ramp80, 80, 40, 1);		// Ramp wave
 		}
 		break;
 
 	case 90:
 		if(wGen->currentWaveSelected == 1){						// Square wave
-			SH1106_DrawBitmap(2, 0, square90, 80, 40, 1);
+			SH1106_DrawSprite(2, 0, square90, 80, 40, 1);
 		}else{
-			SH1106_DrawBitmap(2, 0, ramp90, 80, 40, 1);		// Ramp wave
+			SH1106_DrawSprite(2, 0, ramp90, 80, 40, 1);		// Ramp wave
 		}
 		break;
 
 	default:
 		if(wGen->currentWaveSelected == 1){						// Square wave
-			SH1106_DrawBitmap(2, 0, square50, 80, 40, 1);
+			SH1106_DrawSprite(2, 0, square50, 80, 40, 1);
 		}else{
-			SH1106_DrawBitmap(2, 0, ramp50, 80, 40, 1);		// Ramp wave
+			SH1106_DrawSprite(2, 0, ramp50, 80, 40, 1);		// Ramp wave
 		}
 
 	}  // end switch
@@ -672,7 +1552,6 @@ void updateHundreds(wGen_HandleTypeDef * wGen){
 	// Polling function that reads wGen->frequency value and displays the 100th digit value in that spot
 	// if a rotary tick is detected, wGen->frequency and the display are updated for that 100th digit
 
-	SH1106_DrawFilledRectangle(34, 52, 6, 11, 1);
 	// Read what value wGen->frequency is and draw the 100th digit
 	int num = (wGen->unitDisplay == DISPLAY_UNITS_KHZ ? wGen->frequency / 100000 : wGen->frequency / 100);
 
@@ -695,16 +1574,13 @@ void updateHundreds(wGen_HandleTypeDef * wGen){
 	updateOutputFrequency(wGen);
 	num = (wGen->unitDisplay == DISPLAY_UNITS_KHZ ? wGen->frequency / 100000 : wGen->frequency / 100);
 	SH1106_DrawFilledRectangle(34, 52, 6, 11, 1);
-	char buf[2];
-	sprintf(buf, "%d", num);
 	SH1106_GotoXY( 34, 53);
 	if(num != 0){
-		SH1106_Puts(buf, &Font_7x10, 0);
+		SH1106_Putc('0' + num, &Font_7x10, 0);
 	}
 }
 
 void updateTens(wGen_HandleTypeDef * wGen){
-	SH1106_DrawFilledRectangle(41, 52, 6, 11, 1);
 	// Read what value wGen->frequency is and draw the 10th digit
 	int num = (wGen->unitDisplay == DISPLAY_UNITS_KHZ ? (wGen->frequency % 100000)/10000 : (wGen->frequency % 100) / 10);
 	if(wGen->rotaryDir == 1){
@@ -726,19 +1602,16 @@ void updateTens(wGen_HandleTypeDef * wGen){
 	updateOutputFrequency(wGen);
 	num = (wGen->unitDisplay == DISPLAY_UNITS_KHZ ? (wGen->frequency % 100000)/10000 : (wGen->frequency % 100) / 10);
 	SH1106_DrawFilledRectangle(41, 52, 6, 11, 1);
-	char buf[2];
-	sprintf(buf, "%d", num);
 	SH1106_GotoXY( 41, 53);
 
 	// All the conditions in which '0' will be drawn in the tens position; otherwise it will be left blank
 	if((wGen->frequency >= 100000 && num == 0) || (wGen->frequency < 1000 && wGen->frequency > 99 && num == 0) || (num != 0)){
-		SH1106_Puts(buf, &Font_7x10, 0);
+		SH1106_Putc('0' + num, &Font_7x10, 0);
 	}
 
 }
 
 void updateOnes(wGen_HandleTypeDef * wGen){
-	SH1106_DrawFilledRectangle(48, 52, 6, 11, 1);
 	/// Read what value wGen->frequency is and draw the ones digit
 	int num = (wGen->unitDisplay == DISPLAY_UNITS_KHZ ? (wGen->frequency % 10000)/1000 : wGen->frequency % 10);
 	if(wGen->rotaryDir == 1){
@@ -760,57 +1633,61 @@ void updateOnes(wGen_HandleTypeDef * wGen){
 	updateOutputFrequency(wGen);
 	num = (wGen->unitDisplay == DISPLAY_UNITS_KHZ ? (wGen->frequency % 10000)/1000 : wGen->frequency % 10);
 	SH1106_DrawFilledRectangle(48, 52, 6, 11, 1);
-	char buf[2];
-	sprintf(buf, "%i", num);
 	SH1106_GotoXY( 48, 53);
-	SH1106_Puts(buf, &Font_7x10, 0);
+	SH1106_Putc('0' + num, &Font_7x10, 0);
 }
 
-void updateOutputFrequency(wGen_HandleTypeDef * wGen){
-	if(!deltaFrequency){
+// Loads TIM6 PSC and ARR.  PSC is buffered by the hardware, so an update event is forced to apply it immediately
+static void setTimerRate(uint16_t prescaler, uint16_t period){
+	htim6.Instance->PSC 	= prescaler;
+	htim6.Instance->ARR 	= period;
+	htim6.Init.Prescaler 	= prescaler;
+	htim6.Init.Period 		= period;
+	htim6.Instance->EGR 	= TIM_EGR_UG;
+	__HAL_TIM_CLEAR_FLAG(&htim6, TIM_FLAG_UPDATE);
+}
+
+// Retunes the output to wGen->milliHz
+static void applyFrequency(wGen_HandleTypeDef * wGen){
+	if(wGen->outputMode == OUTPUT_MODE_DDS){
+		// Sample rate is fixed, so only the tuning word changes; the next half-buffer refill picks it up
+		getSamples(wGen);
 		return;
 	}
-	HAL_DAC_Stop_DMA(&hdac1, DAC_CHANNEL_1);
+	stopOutput();
 	HAL_TIM_Base_Stop_IT(&htim6);
 	getSamples(wGen);
-
-	// Determine what number to use for an array index
-	int num = wGen->unitDisplay == DISPLAY_UNITS_KHZ ? wGen->frequency/1000 + 999 : wGen->frequency - 1;
-
-	htim6.Instance->ARR = ARR_period[num];
-	htim6.Init.Period 	= htim6.Instance->ARR;
+	setTimerRate(tableTiming.prescaler, tableTiming.period);
 
 	HAL_TIM_Base_Start_IT(&htim6);
-	HAL_DAC_Start_DMA(&hdac1, DAC_CHANNEL_1, TX_Bits, samples, DAC_ALIGN_12B_R);
+	startOutput();
+}
+
+// Frequency digits were edited on the front panel; wGen->frequency is whole hertz
+void updateOutputFrequency(wGen_HandleTypeDef * wGen){
+	if(!deltaFrequency){
+		return;
+	}
+	wGen->milliHz = wGen->frequency * 1000;
+	applyFrequency(wGen);
 	deltaFrequency = 0;
 }
 
 void updatePercent(wGen_HandleTypeDef * wGen){
 	SH1106_DrawFilledRectangle(84, 52, 28, 11, 1);
+	uint16_t tenths = wGen->dutyTenths;
 	if(wGen->rotaryDir == 1){
-		if(wGen->currentPercent < 90){
-			wGen->currentPercent += 10;
-		}
+		tenths = (tenths + 100 > 900 ? 900 : tenths + 100);
 	}else if(wGen->rotaryDir == -1){
-		if(wGen->currentPercent > 10){
-			wGen->currentPercent -= 10;
-		}
+		tenths = (tenths < 200 ? 100 : tenths - 100);
 	}
+	setDuty(wGen, tenths);
 	updateBitmap(wGen);
-	char buf[2];
+	char buf[4];
 	sprintf(buf, "%i", wGen->currentPercent);
 	SH1106_GotoXY(85, 53);
 	SH1106_Puts(buf, &Font_7x10, 0);
 	SH1106_Puts(" %", &Font_7x10, 0);
-	if(wGen->currentWaveSelected == 2 && wGen->isTransmitting){
-		HAL_DAC_Stop_DMA(&hdac1, DAC_CHANNEL_1);
-		getRampVal(wGen);
-		HAL_DAC_Start_DMA(&hdac1, DAC_CHANNEL_1, TX_Bits, samples, DAC_ALIGN_12B_R);
-	}else if(wGen->currentWaveSelected == 1 && wGen->isTransmitting){
-		HAL_DAC_Stop_DMA(&hdac1, DAC_CHANNEL_1);
-		getSquareVal(wGen);
-		HAL_DAC_Start_DMA(&hdac1, DAC_CHANNEL_1, TX_Bits, samples, DAC_ALIGN_12B_R);
-	}
 	SH1106_UpdateScreen();
 }
 
@@ -882,7 +1759,7 @@ void updateTimerPeriod(wGen_HandleTypeDef * wGen){
 		getSineVal(wGen);
 	}
 
-	HAL_DAC_Stop_DMA(&hdac1, DAC_CHANNEL_1);
+	stopOutput();
 	HAL_TIM_Base_Stop_IT(&htim6);
 
 	if(wGen->rotaryDir == 1){
@@ -903,7 +1780,7 @@ void updateTimerPeriod(wGen_HandleTypeDef * wGen){
 	SH1106_GotoXY(2, 23);
 	SH1106_Puts(buf, &Font_7x10, 1);
 	HAL_TIM_Base_Start_IT(&htim6);
-	HAL_DAC_Start_DMA(&hdac1, DAC_CHANNEL_1, TX_Bits, samples, DAC_ALIGN_12B_R);
+	startOutput();
 
 }
 
@@ -915,16 +1792,12 @@ void updateWaveform(wGen_HandleTypeDef * wGen){
 			if(wGen->rotaryDir){
 				square(wGen);
 				if(wGen->isTransmitting){
-					HAL_DAC_Stop_DMA(&hdac1, DAC_CHANNEL_1);
-					getSquareVal(wGen);
-					HAL_DAC_Start_DMA(&hdac1, DAC_CHANNEL_1, TX_Bits, samples, DAC_ALIGN_12B_R);
+					refreshOutput(wGen);
 				}
 			}else{
 				ramp(wGen);
 				if(wGen->isTransmitting){
-					HAL_DAC_Stop_DMA(&hdac1, DAC_CHANNEL_1);
-					getRampVal(wGen);
-					HAL_DAC_Start_DMA(&hdac1, DAC_CHANNEL_1, TX_Bits, samples, DAC_ALIGN_12B_R);
+					refreshOutput(wGen);
 				}
 			}
 			SH1106_GotoXY(85, 53);
@@ -938,16 +1811,12 @@ void updateWaveform(wGen_HandleTypeDef * wGen){
 			if(wGen->rotaryDir){
 				ramp(wGen);
 				if(wGen->isTransmitting){
-					HAL_DAC_Stop_DMA(&hdac1, DAC_CHANNEL_1);
-					getRampVal(wGen);
-					HAL_DAC_Start_DMA(&hdac1, DAC_CHANNEL_1, TX_Bits, samples, DAC_ALIGN_12B_R);
+					refreshOutput(wGen);
 				}
 			}else{
 				sine(wGen);
 				if(wGen->isTransmitting){
-					HAL_DAC_Stop_DMA(&hdac1, DAC_CHANNEL_1);
-					getSineVal(wGen);
-					HAL_DAC_Start_DMA(&hdac1, DAC_CHANNEL_1, TX_Bits, samples, DAC_ALIGN_12B_R);
+					refreshOutput(wGen);
 				}
 			}
 			break;
@@ -956,20 +1825,24 @@ void updateWaveform(wGen_HandleTypeDef * wGen){
 			if(wGen->rotaryDir){
 				sine(wGen);
 				if(wGen->isTransmitting){
-					HAL_DAC_Stop_DMA(&hdac1, DAC_CHANNEL_1);
-					getSineVal(wGen);
-					HAL_DAC_Start_DMA(&hdac1, DAC_CHANNEL_1, TX_Bits, samples, DAC_ALIGN_12B_R);
+					refreshOutput(wGen);
 				}
 			}else{
 				square(wGen);
 				if(wGen->isTransmitting){
-					HAL_DAC_Stop_DMA(&hdac1, DAC_CHANNEL_1);
-					getSquareVal(wGen);
-					HAL_DAC_Start_DMA(&hdac1, DAC_CHANNEL_1, TX_Bits, samples, DAC_ALIGN_12B_R);
+					refreshOutput(wGen);
 				}
 			}
 			break;
 
+		case 3:		// ARB is only entered by an upload, so either direction leaves it for SINE
+			SH1106_DrawFilledRectangle(2, 52, 28, 11, 1);
+			sine(wGen);
+			if(wGen->isTransmitting){
+				refreshOutput(wGen);
+			}
+			break;
+
 	}
 	SH1106_UpdateScreen();
 }
@@ -0,0 +1,48 @@
+/*
+ *
+ *  Created on: 10/18/2026
+ *  ----------------------------------------------------------------------
+   	Copyright (C) Michael Kurta, 2024
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+ */
+
+
+// Timing helper for the host benchmarks.  Numbers are for the build machine, not the H723; they compare two
+// implementations of the same thing on equal terms, which is what the commits quote them for.
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#define BENCH_MIN_NS		200000000.0		// Each measurement repeats until it has run this long
+
+static volatile uint32_t benchSink;			// Benchmarks fold a result in here so the work is not optimised away
+
+static inline double benchNow(void){
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+// Runs 'body' until BENCH_MIN_NS have passed and prints the mean time of one run
+#define BENCH(label, body)	do{ uint32_t runs_ = 0; double start_ = benchNow(), took_;					\
+								do{ body; runs_++; }while((took_ = benchNow() - start_) < BENCH_MIN_NS);	\
+								printf("  %-44s %10.3f us\n", label, took_ / runs_ / 1000); }while(0)
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ * bench_patch.c
+ *
+ *  Created on: 10/18/2026
+ */
+
+// Times a table-path duty change on a naive square both ways: regenerating and leveling the whole cycle, as
+// refreshOutput() does, against rewriting only the samples between the old and new edge, as patchDuty() /
+// applyPatch() do.  Every patched buffer is also checked against a full regenerate.
+
+#include <string.h>
+#include "bench.h"
+#include "synth.h"
+
+#define BENCH_LEVEL_AMPLITUDE	3000			// Not unity, so the level pass does real work
+#define BENCH_LEVEL_OFFSET		-100
+
+static uint16_t raw[4000];
+static uint16_t bits[4000];
+static uint16_t reference[4000];
+static uint16_t samples;
+static uint16_t patchStart, patchEnd;
+
+static void regenerate(uint16_t tenths, Synth_LevelTypeDef level){
+	synthSquare(raw, samples, tenths);
+	synthApplyLevel(raw, bits, samples, level);
+}
+
+// The span patchDuty() works out for a move from one duty to another
+static void span(uint16_t fromTenths, uint16_t toTenths){
+	uint32_t from	= synthDutyEdge(samples, fromTenths);
+	uint32_t to		= synthDutyEdge(samples, toTenths);
+	patchStart		= (to > from ? from : to) >> 16;
+	patchEnd		= ((to > from ? to : from) >> 16) + 1;
+	if(patchEnd > samples){
+		patchEnd = samples;
+	}
+}
+
+static void patch(uint16_t tenths, Synth_LevelTypeDef level){
+	synthSquareSpan(raw, samples, tenths, patchStart, patchEnd);
+	synthApplyLevel(&raw[patchStart], &bits[patchStart], patchEnd - patchStart, level);
+}
+
+int main(void){
+	static const uint16_t sizes[] = { 4000, 1000, 100 };
+	Synth_LevelTypeDef level = synthLevel(BENCH_LEVEL_AMPLITUDE, BENCH_LEVEL_OFFSET);
+	uint32_t mismatches = 0;
+
+	// Every 10% step the encoder can make, both directions, patched buffers against a fresh regenerate
+	for(uint8_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++){
+		samples = sizes[s];
+		for(uint16_t from = 100; from <= 900; from += 100){
+			for(uint16_t to = 100; to <= 900; to += 100){
+				regenerate(from, level);
+				span(from, to);
+				patch(to, level);
+				synthSquare(reference, samples, to);
+				synthApplyLevel(reference, reference, samples, level);
+				mismatches += (memcmp(bits, reference, samples * sizeof(uint16_t)) != 0);
+			}
+		}
+	}
+	printf("patched against regenerated: %u mismatches\n", mismatches);
+
+	for(uint8_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++){
+		samples = sizes[s];
+		printf("%u samples, duty 50%% to 60%%\n", samples);
+		regenerate(500, level);
+		BENCH("full regenerate and level", { regenerate(600, level); benchSink += bits[samples / 2]; });
+		span(500, 600);
+		BENCH("edge patch and level", { patch(600, level); benchSink += bits[samples / 2]; });
+	}
+	return mismatches ? 1 : 0;
+}
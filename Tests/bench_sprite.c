@@ -0,0 +1,128 @@
+/*
+ * bench_sprite.c
+ *
+ *  Created on: 10/18/2026
+ */
+
+// Draws the waveform sprites through SH1106_DrawSprite() (page-major) and through SH1106_DrawBitmap() from a
+// row-major copy, the layout bitmap.h used before.  Checks both leave the same framebuffer at every position
+// and colour, then times one sprite each way.  SH1106.c is compiled into this file for its framebuffer.
+
+#include "bench.h"
+#include "../Core/Src/SH1106.c"
+#include "bitmap.h"
+
+#define BENCH_ROW_BYTES(w)		(((w) + 7) / 8)
+
+typedef struct {
+	const char *		name;
+	const uint8_t *		sprite;
+	uint8_t				w;
+	uint8_t				h;
+} Bench_SpriteTypeDef;
+
+static const Bench_SpriteTypeDef sprites[] = {
+	{ "sinewave", sinewave, 80, 40 },
+	{ "square10", square10, 80, 40 }, { "square20", square20, 80, 40 }, { "square30", square30, 80, 40 },
+	{ "square40", square40, 80, 40 }, { "square50", square50, 80, 40 }, { "square60", square60, 80, 40 },
+	{ "square70", square70, 80, 40 }, { "square80", square80, 80, 40 }, { "square90", square90, 80, 40 },
+	{ "ramp10", ramp10, 80, 40 }, { "ramp20", ramp20, 80, 40 }, { "ramp30", ramp30, 80, 40 },
+	{ "ramp40", ramp40, 80, 40 }, { "ramp50", ramp50, 80, 40 }, { "ramp60", ramp60, 80, 40 },
+	{ "ramp70", ramp70, 80, 40 }, { "ramp80", ramp80, 80, 40 }, { "ramp90", ramp90, 80, 40 },
+	{ "TX_Icon", TX_Icon, 10, 10 }
+};
+
+I2C_HandleTypeDef hi2c1;
+static uint8_t rowMajor[BENCH_ROW_BYTES(80) * 40];
+static uint8_t expected[sizeof(SH1106_Buffer)];
+
+uint32_t HAL_GetTick(void){
+	return 0;
+}
+
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef * hi2c, uint16_t address, uint32_t trials, uint32_t timeout){
+	(void)hi2c; (void)address; (void)trials; (void)timeout;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef * hi2c, uint16_t address, uint8_t * data, uint16_t size,
+		uint32_t timeout){
+	(void)hi2c; (void)address; (void)data; (void)size; (void)timeout;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef * hi2c, uint16_t address, uint8_t * data, uint16_t size){
+	(void)hi2c; (void)address; (void)data; (void)size;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Seq_Transmit_DMA(I2C_HandleTypeDef * hi2c, uint16_t address, uint8_t * data,
+		uint16_t size, uint32_t options){
+	(void)hi2c; (void)address; (void)data; (void)size; (void)options;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef * hi2c, uint16_t address, uint16_t memAddress,
+		uint16_t memAddSize, uint8_t * data, uint16_t size, uint32_t timeout){
+	(void)hi2c; (void)address; (void)memAddress; (void)memAddSize; (void)data; (void)size; (void)timeout;
+	return HAL_OK;
+}
+
+void dmaBufferClean(const void * addr, uint32_t bytes){
+	(void)addr;
+	(void)bytes;
+}
+
+// Row-major, MSB first, each row padded to a whole byte: what SH1106_DrawBitmap() reads
+static void toRowMajor(const Bench_SpriteTypeDef * s){
+	memset(rowMajor, 0, sizeof(rowMajor));
+	for(uint8_t y = 0; y < s->h; y++){
+		for(uint8_t x = 0; x < s->w; x++){
+			if(s->sprite[(y / 8) * s->w + x] & (1 << (y % 8))){
+				rowMajor[y * BENCH_ROW_BYTES(s->w) + x / 8] |= 0x80 >> (x % 8);
+			}
+		}
+	}
+}
+
+int main(void){
+	static const uint8_t xs[] = { 0, 1, 2, 7, 33, 48, 50, 100, 120, 127 };
+	static const uint8_t ys[] = { 0, 3, 8, 13, 24, 31, 63 };
+	uint32_t checked = 0, mismatches = 0;
+
+	for(uint8_t s = 0; s < sizeof(sprites) / sizeof(sprites[0]); s++){
+		toRowMajor(&sprites[s]);
+		for(uint8_t c = 0; c < 2; c++){
+			SH1106_COLOR_t color = (c ? SH1106_COLOR_BLACK : SH1106_COLOR_WHITE);
+			for(uint8_t i = 0; i < sizeof(xs); i++){
+				for(uint8_t j = 0; j < sizeof(ys); j++){
+					SH1106_Fill(c ? SH1106_COLOR_WHITE : SH1106_COLOR_BLACK);
+					SH1106_DrawBitmap(xs[i], ys[j], rowMajor, sprites[s].w, sprites[s].h, color);
+					memcpy(expected, SH1106_Buffer, sizeof(expected));
+
+					SH1106_Fill(c ? SH1106_COLOR_WHITE : SH1106_COLOR_BLACK);
+					SH1106_DrawSprite(xs[i], ys[j], sprites[s].sprite, sprites[s].w, sprites[s].h, color);
+					if(memcmp(expected, SH1106_Buffer, sizeof(expected))){
+						printf("  %s at (%u, %u), colour %u differs\n", sprites[s].name, xs[i], ys[j], color);
+						mismatches++;
+					}
+					checked++;
+				}
+			}
+		}
+	}
+	printf("DrawSprite against DrawBitmap: %u draws, %u mismatches\n", checked, mismatches);
+
+	toRowMajor(&sprites[0]);
+	printf("sinewave, 80 x 40\n");
+	BENCH("DrawBitmap at (2, 0)", { SH1106_Fill(SH1106_COLOR_BLACK);
+			SH1106_DrawBitmap(2, 0, rowMajor, 80, 40, SH1106_COLOR_WHITE); benchSink += SH1106_Buffer[40]; });
+	BENCH("DrawSprite at (2, 0)", { SH1106_Fill(SH1106_COLOR_BLACK);
+			SH1106_DrawSprite(2, 0, sinewave, 80, 40, SH1106_COLOR_WHITE); benchSink += SH1106_Buffer[40]; });
+	BENCH("DrawBitmap at (2, 3)", { SH1106_Fill(SH1106_COLOR_BLACK);
+			SH1106_DrawBitmap(2, 3, rowMajor, 80, 40, SH1106_COLOR_WHITE); benchSink += SH1106_Buffer[40]; });
+	BENCH("DrawSprite at (2, 3)", { SH1106_Fill(SH1106_COLOR_BLACK);
+			SH1106_DrawSprite(2, 3, sinewave, 80, 40, SH1106_COLOR_WHITE); benchSink += SH1106_Buffer[40]; });
+	BENCH("Fill alone", { SH1106_Fill(SH1106_COLOR_BLACK); benchSink += SH1106_Buffer[40]; });
+	return mismatches ? 1 : 0;
+}
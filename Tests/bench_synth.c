@@ -0,0 +1,77 @@
+/*
+ * bench_synth.c
+ *
+ *  Created on: 10/18/2026
+ */
+
+// Times the integer synth kernels against the float generators they replaced (getSineVal, getSquareVal and
+// getRampVal as they were, copied below).  On the host synthSine() runs the software CORDIC that the H723
+// replaces with the coprocessor, so the polynomial synthSinQ30() is timed on its own as well.  The host has a
+// fast libm sin(); the float rows are the ones that change most on the target.
+
+#include <math.h>
+#include "bench.h"
+#include "synth.h"
+
+#define RESOLUTION_12BIT	4096
+#define pi					3.14152				// As the old wgen.c had it
+
+static uint32_t TX_Bits[4000];
+static uint16_t buf[4000];
+static uint16_t samples;
+static uint16_t currentPercent = 50;
+
+static void polySine(void){
+	uint32_t step = (uint32_t)(0x100000000ULL / samples);
+	for(uint16_t i = 0; i < samples; i++){
+		buf[i] = synthQ30ToDac(synthSinQ30(i * step));
+	}
+}
+
+static void oldSine(void){
+	for(int i = 0; i < samples; i++){
+		TX_Bits[i] = ((sin(i * 2 * pi / samples) + 1)) * RESOLUTION_12BIT / 2;
+	}
+}
+
+static void oldSquare(void){
+	for(int i = 0; i < samples; i++){
+		TX_Bits[i] = ((float)currentPercent/100 * samples < i ? 0 : RESOLUTION_12BIT - 1);
+	}
+}
+
+static void oldRamp(void){
+	uint16_t rampUpDivs =   round(currentPercent * samples / 100) ;
+	uint16_t rampDownDivs = samples - rampUpDivs;
+	float divSize = 4095 / rampUpDivs;
+	float accumulator = 0;
+	int i;
+	for(i = 0; i < rampUpDivs; i++){
+		accumulator += divSize;
+		TX_Bits[i] = round(accumulator);
+	}
+
+	divSize = 4095 / rampDownDivs;
+	accumulator = RESOLUTION_12BIT - 1;
+	for(i = rampUpDivs; i < samples; i++){
+		accumulator -= divSize;
+		TX_Bits[i] = round(accumulator);
+	}
+}
+
+int main(void){
+	static const uint16_t sizes[] = { 4000, 1000, 100 };
+
+	for(uint8_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++){
+		samples = sizes[s];
+		printf("%u samples\n", samples);
+		BENCH("sine, float sin()", { oldSine(); benchSink += TX_Bits[samples / 4]; });
+		BENCH("sine, synthSinQ30() polynomial", { polySine(); benchSink += buf[samples / 4]; });
+		BENCH("sine, synthSine() software CORDIC", { synthSine(buf, samples); benchSink += buf[samples / 4]; });
+		BENCH("square, float compare", { oldSquare(); benchSink += TX_Bits[samples / 4]; });
+		BENCH("square, synthSquare()", { synthSquare(buf, samples, 500); benchSink += buf[samples / 4]; });
+		BENCH("ramp, float round()", { oldRamp(); benchSink += TX_Bits[samples / 4]; });
+		BENCH("ramp, synthRamp()", { synthRamp(buf, samples, 500); benchSink += buf[samples / 4]; });
+	}
+	return 0;
+}
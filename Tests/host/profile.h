@@ -0,0 +1,27 @@
+/*
+ * profile.h
+ *
+ *  Created on: 10/18/2026
+ */
+
+// Host stand-in for Core/Inc/profile.h: there is no DWT cycle counter, and the benchmarks time themselves.
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+#include <stdint.h>
+
+#define PROFILE_SYNTH				0
+#define PROFILE_DISPLAY				1
+#define PROFILE_DAC_ISR				2
+
+static inline uint32_t profileStart(void){
+	return 0;
+}
+
+static inline void profileStop(uint8_t slot, uint32_t start){
+	(void)slot;
+	(void)start;
+}
+
+#endif
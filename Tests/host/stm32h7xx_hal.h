@@ -0,0 +1,40 @@
+/*
+ * stm32h7xx_hal.h
+ *
+ *  Created on: 10/18/2026
+ */
+
+// Host stand-in for the HAL, just enough for SH1106.c to compile in the benchmarks.  The I2C calls are defined
+// by the benchmark and do nothing.
+
+#ifndef STM32H7XX_HAL_H_
+#define STM32H7XX_HAL_H_
+
+#include <stdint.h>
+
+typedef struct {
+	uint32_t			unused;
+} I2C_HandleTypeDef;
+
+typedef enum {
+	HAL_OK				= 0x00,
+	HAL_ERROR			= 0x01
+} HAL_StatusTypeDef;
+
+#define I2C_OTHER_FRAME				0x000000AAU
+#define I2C_LAST_FRAME				0x02000000U
+#define I2C_MEMADD_SIZE_8BIT		0x00000001U
+
+uint32_t HAL_GetTick(void);
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef * hi2c, uint16_t address, uint32_t trials, uint32_t timeout);
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef * hi2c, uint16_t address, uint8_t * data, uint16_t size,
+		uint32_t timeout);
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef * hi2c, uint16_t address, uint8_t * data, uint16_t size);
+HAL_StatusTypeDef HAL_I2C_Master_Seq_Transmit_DMA(I2C_HandleTypeDef * hi2c, uint16_t address, uint8_t * data,
+		uint16_t size, uint32_t options);
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef * hi2c, uint16_t address, uint16_t memAddress,
+		uint16_t memAddSize, uint8_t * data, uint16_t size, uint32_t timeout);
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef * hi2c);
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef * hi2c);
+
+#endif
@@ -0,0 +1,154 @@
+/*
+ * test_dds.c
+ *
+ *  Created on: 10/18/2026
+ */
+
+// Host test for the DDS engine: tuning word accuracy over the whole front panel range, cycle count over one
+// second of output, and phase continuity across the settings changes the DAC callbacks make between halves.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "dds.h"
+
+#define TEST_MAX_MILLIHZ	((DDS_SAMPLE_RATE_HZ / 10) * 1000UL)	// DDS_MAX_MILLIHZ in wgen.h
+#define TEST_HALF			512										// DDS_BUF_SIZE / 2 in wgen.h
+#define TEST_HALVES			20000
+
+#define CHECK(cond, ...)	do{ if(!(cond)){ printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); \
+								printf("\n"); failures++; } }while(0)
+
+static uint16_t sineTable[DDS_TABLE_SIZE];
+static uint16_t buf[DDS_SAMPLE_RATE_HZ];
+static int failures;
+
+static void testTuningWord(void){
+	uint32_t milliHz;
+	double worstMilliHz = 0;
+
+	// Log spaced from 1 mHz to the top of the range, plus every Hz of the low end
+	for(double f = 1; f <= TEST_MAX_MILLIHZ; f *= 1.001){
+		milliHz = (uint32_t)f;
+		uint32_t tw			= ddsTuningWord(milliHz);
+		uint32_t actual		= ddsActualMilliHz(tw);
+		double exact		= (double)tw * DDS_SAMPLE_RATE_HZ * 1000.0 / 4294967296.0;
+		double errPpb		= (exact - milliHz) * 1e9 / milliHz;
+
+		CHECK(fabs(exact - milliHz) <= DDS_SAMPLE_RATE_HZ * 1000.0 / 8589934592.0 + 1e-9,
+				"%u mHz: tuning word %u is %.4f mHz off", milliHz, tw, exact - milliHz);
+		CHECK(labs((long)actual - (long)milliHz) <= 1, "%u mHz: reports %u mHz", milliHz, actual);
+		CHECK(fabs(ddsErrorPpb(milliHz, tw) - errPpb) <= 1.0, "%u mHz: %d ppb, expected %.1f",
+				milliHz, ddsErrorPpb(milliHz, tw), errPpb);
+		if(milliHz >= 320000){
+			CHECK(fabs(errPpb) <= 1000, "%u mHz: %.1f ppb is over 1 ppm", milliHz, errPpb);
+		}
+		if(fabs(exact - milliHz) > worstMilliHz){
+			worstMilliHz = fabs(exact - milliHz);
+		}
+	}
+	for(milliHz = 1000; milliHz <= 1000000; milliHz += 1000){
+		uint32_t tw = ddsTuningWord(milliHz);
+		CHECK(labs((long)ddsActualMilliHz(tw) - (long)milliHz) <= 1, "%u mHz: reports %u mHz", milliHz,
+				ddsActualMilliHz(tw));
+	}
+	printf("tuning word: worst error %.4f mHz\n", worstMilliHz);
+}
+
+// Counts rising edges of the square output over exactly one second of samples
+static void testCycleCount(void){
+	static const uint32_t freqs[] = { 1000, 999999, 1000000, 12345678, 100000000, 262144000, TEST_MAX_MILLIHZ };
+
+	for(uint32_t n = 0; n < sizeof(freqs) / sizeof(freqs[0]); n++){
+		DDS_HandleTypeDef dds = dds_create(sineTable);
+		dds.waveform = DDS_WAVE_SQUARE;
+		ddsSetFrequency(&dds, freqs[n]);
+		dds.phase = 0x80000000;							// Start low so the first rise is counted
+		ddsFill(&dds, buf, 1);
+
+		uint32_t edges = 0;
+		uint16_t last = buf[0];
+		for(uint32_t done = 1; done < DDS_SAMPLE_RATE_HZ; ){
+			uint16_t count = (DDS_SAMPLE_RATE_HZ - done > 65535 ? 65535 : DDS_SAMPLE_RATE_HZ - done);
+			ddsFill(&dds, buf, count);
+			for(uint16_t i = 0; i < count; i++){
+				edges += (buf[i] > last);
+				last = buf[i];
+			}
+			done += count;
+		}
+		uint32_t cycles = ddsActualMilliHz(dds.tuningWord) / 1000;
+		CHECK(edges >= cycles && edges <= cycles + 1, "%u mHz: %u cycles in one second, expected %u",
+				freqs[n], edges, cycles);
+	}
+}
+
+// Reloads random settings between halves and follows the output with an independent accumulator: every
+// sample has to come from where the phase was, whatever the frequency, waveform or duty just became
+static void testPhaseContinuity(void){
+	DDS_HandleTypeDef dds = dds_create(sineTable);
+	DDS_HandleTypeDef next;
+	uint32_t phase = 0;
+	uint32_t worstStep = 0;
+	uint16_t last = 0;
+	uint8_t lastWave = DDS_WAVE_SQUARE;
+
+	srand(1);
+	ddsSetFrequency(&dds, 1000000);
+	for(uint32_t half = 0; half < TEST_HALVES; half++){
+		next = dds;
+		ddsSetFrequency(&next, (uint32_t)(((uint64_t)rand() << 16 ^ rand()) % TEST_MAX_MILLIHZ) + 1);
+		next.waveform = (half & 1 ? DDS_WAVE_SINE : (uint8_t)(rand() % 3));
+		ddsSetDuty(&next, (uint16_t)(10 + rand() % 981));
+		ddsLoadSettings(&dds, &next);
+
+		CHECK(dds.phase == phase, "half %u: phase %08x after reload, expected %08x", half, dds.phase, phase);
+		ddsFill(&dds, buf, TEST_HALF);
+
+		for(uint16_t i = 0; i < TEST_HALF; i++, phase += dds.tuningWord){
+			uint16_t want;
+			switch(dds.waveform){
+			case DDS_WAVE_SQUARE:
+				want = (phase < dds.dutyPhase ? DDS_FULL_SCALE : 0);
+				break;
+			case DDS_WAVE_RAMP:
+				want = (uint16_t)(phase < dds.dutyPhase ? (double)phase * DDS_FULL_SCALE / dds.dutyPhase :
+						(4294967296.0 - phase) * DDS_FULL_SCALE / (4294967296.0 - dds.dutyPhase));
+				break;
+			default:
+				want = sineTable[(uint64_t)phase * DDS_TABLE_SIZE >> 32];
+			}
+			// The ramp's Q48 gain truncates, so it may land one code under the exact value
+			CHECK(buf[i] == want || (dds.waveform == DDS_WAVE_RAMP && buf[i] + 1 == want),
+					"half %u sample %u: %u, expected %u", half, i, buf[i], want);
+
+			// A sine that carries on, across the reload too, never steps more than the fastest tone allows
+			if(dds.waveform == DDS_WAVE_SINE && (i > 0 || lastWave == DDS_WAVE_SINE)){
+				uint32_t step = (uint32_t)abs((int)buf[i] - (int)last);
+				if(step > worstStep){
+					worstStep = step;
+				}
+			}
+			last = buf[i];
+		}
+		lastWave = dds.waveform;
+		CHECK(dds.phase == phase, "half %u: phase %08x after fill, expected %08x", half, dds.phase, phase);
+	}
+	uint32_t limit = (uint32_t)ceil(M_PI * DDS_FULL_SCALE * TEST_MAX_MILLIHZ / 1000.0 / DDS_SAMPLE_RATE_HZ) + 2;
+	CHECK(worstStep <= limit, "sine stepped %u codes, limit %u", worstStep, limit);
+	printf("phase continuity: %u halves, largest sine step %u codes (limit %u)\n", TEST_HALVES, worstStep, limit);
+}
+
+int main(void){
+
+	for(uint16_t i = 0; i < DDS_TABLE_SIZE; i++){
+		sineTable[i] = (uint16_t)lround((sin(2 * M_PI * i / DDS_TABLE_SIZE) + 1) * DDS_FULL_SCALE / 2);
+	}
+
+	testTuningWord();
+	testCycleCount();
+	testPhaseContinuity();
+
+	printf("test_dds: %s (%d failures)\n", failures ? "FAILED" : "passed", failures);
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
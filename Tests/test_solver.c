@@ -0,0 +1,106 @@
+/*
+ * test_solver.c
+ *
+ *  Created on: 10/18/2026
+ */
+
+// Host test for the table-mode timing solver: every result over the front panel range (1 Hz to 999 kHz) must
+// respect the DAC update and TX_Bits limits, report the frequency it really produces, and be within 1 ppm or
+// close to the best any samples / ticks split allows.  Near the top of the range the few sample counts left
+// make errors of a few percent unavoidable, so the bound there comes from an exhaustive search.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "solver.h"
+
+#define TEST_MAX_HZ			999000			// Front panel limit, MAX_FREQ_KHZ digits
+#define TEST_DENSE_HZ		20000			// Every Hz up to here, a stride above
+#define TEST_STRIDE_HZ		7
+#define TEST_PSC_PPB		7630			// ARR rounding once PSC > 1: half a count in 65536, 1e9 / 131072
+
+#define CHECK(cond, ...)	do{ if(!(cond)){ printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); \
+								printf("\n"); failures++; } }while(0)
+
+static int failures;
+
+// Smallest error of any samples * ticks divider within the limits, ignoring how ticks splits into PSC and ARR
+static double bestPpb(uint32_t milliHz){
+	double best = 1e18;
+	double dividerWanted = SOLVER_TIMER_CLOCK_HZ * 1000.0 / milliHz;
+
+	for(uint32_t n = SOLVER_MIN_SAMPLES; n <= SOLVER_MAX_SAMPLES; n++){
+		double ticks = round(dividerWanted / n);
+		if(ticks < SOLVER_MIN_TICKS){
+			if(n * SOLVER_MIN_TICKS > 2 * dividerWanted){
+				break;
+			}
+			ticks = SOLVER_MIN_TICKS;
+		}
+		double ppb = fabs(dividerWanted / (ticks * n) - 1) * 1e9;
+		if(ppb < best){
+			best = ppb;
+		}
+	}
+	return best;
+}
+
+static void checkOne(uint32_t milliHz, int32_t * worstPpb, uint32_t * worstAt){
+	Solver_ResultTypeDef result;
+
+	if(!solverFind(milliHz, &result)){
+		CHECK(0, "%u mHz: no solution", milliHz);
+		return;
+	}
+
+	uint64_t ticks		= (uint64_t)(result.prescaler + 1) * (result.period + 1);
+	double divider		= (double)ticks * result.samples;
+	double exact		= SOLVER_TIMER_CLOCK_HZ * 1000.0 / divider;
+	double errorPpb		= (exact - milliHz) * 1e9 / milliHz;
+
+	CHECK(result.samples >= SOLVER_MIN_SAMPLES && result.samples <= SOLVER_MAX_SAMPLES,
+			"%u mHz: %u samples", milliHz, result.samples);
+	CHECK(ticks >= SOLVER_MIN_TICKS, "%u mHz: %llu ticks per sample", milliHz, (unsigned long long)ticks);
+	CHECK(fabs(exact - result.actualMilliHz) <= 0.5, "%u mHz: reports %u mHz, settings give %.3f",
+			milliHz, result.actualMilliHz, exact);
+	CHECK(fabs(errorPpb - result.errorPpb) <= 1.0 + fabs(errorPpb) * 1e-6, "%u mHz: reports %d ppb, settings give %.1f",
+			milliHz, result.errorPpb, errorPpb);
+	if(labs(result.errorPpb) > SOLVER_GOOD_PPB){
+		double best = bestPpb(milliHz);
+		CHECK(labs(result.errorPpb) <= best + TEST_PSC_PPB, "%u mHz: %d ppb, %.0f ppb is possible",
+				milliHz, result.errorPpb, best);
+	}
+
+	if(labs(result.errorPpb) > labs(*worstPpb)){
+		*worstPpb	= result.errorPpb;
+		*worstAt	= milliHz;
+	}
+}
+
+int main(void){
+	Solver_ResultTypeDef result;
+	int32_t worstPpb	= 0;
+	uint32_t worstAt	= 0;
+	uint32_t hz;
+
+	for(hz = 1; hz <= TEST_MAX_HZ; hz += (hz < TEST_DENSE_HZ ? 1 : TEST_STRIDE_HZ)){
+		checkOne(hz * 1000, &worstPpb, &worstAt);
+	}
+	checkOne(TEST_MAX_HZ * 1000, &worstPpb, &worstAt);
+
+	// Sub-hertz settings the knob can reach, and the edges of what the limits allow
+	for(uint32_t milliHz = 1000; milliHz < 2000; milliHz++){
+		checkOne(milliHz, &worstPpb, &worstAt);
+	}
+	uint32_t topMilliHz = (uint32_t)((uint64_t)SOLVER_TIMER_CLOCK_HZ * 1000 / (SOLVER_MIN_TICKS * SOLVER_MIN_SAMPLES));
+	checkOne(topMilliHz, &worstPpb, &worstAt);
+	CHECK(!solverFind(0, &result), "0 mHz: found a solution");
+	CHECK(!solverFind(topMilliHz * 2, &result), "%u mHz: found a solution above the DAC limit", topMilliHz * 2);
+
+	// Low frequencies have the room for the full table
+	CHECK(solverFind(1000, &result) && result.samples == SOLVER_MAX_SAMPLES, "1 Hz: %u samples", result.samples);
+
+	printf("solver: worst error %d ppb at %u mHz\n", worstPpb, worstAt);
+	printf("test_solver: %s (%d failures)\n", failures ? "FAILED" : "passed", failures);
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,89 @@
+/*
+ * test_synth_sfdr.c
+ *
+ *  Created on: 10/18/2026
+ */
+
+// Host test for the band-limited square and ramp kernels.  One table cycle of N samples holds harmonics up to
+// N / 2; the naive kernels fold everything above that back down as spurs, the BLEP / BLAMP kernels should not.
+// Each harmonic of the DFT is compared with the ideal continuous waveform (both normalised to the fundamental)
+// and the largest difference is the spur level; SFDR is that in dB below the fundamental.  The 8-tap kernel
+// rolls off well before Nyquist, so only harmonics up to N / 8, where it is flat, are compared; that leaves
+// nothing to measure in a 10-sample cycle, so the tiers start at 50.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "synth.h"
+
+#define TEST_MAX_SAMPLES	4000
+#define TEST_BAND			8				// Harmonics compared: 2 to N / TEST_BAND
+#define TEST_SQUARE_GAIN	15.0			// dB the BLEP square must gain over the naive one
+#define TEST_SQUARE_MIN		60.0			// dB SFDR the BLEP square must reach
+#define TEST_RAMP_LOSS		0.5				// dB the BLAMP ramp may lose to the naive one, rounding only
+#define TEST_RAMP_MIN		75.0			// dB SFDR the BLAMP ramp must reach; 12-bit codes floor it near 78
+
+#define CHECK(cond, ...)	do{ if(!(cond)){ printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); \
+								printf("\n"); failures++; } }while(0)
+
+typedef void (* Kernel)(uint16_t * buf, uint16_t count, uint16_t tenths);
+
+static uint16_t buf[TEST_MAX_SAMPLES];
+static int failures;
+
+static double harmonic(const uint16_t * samples, uint16_t count, uint16_t k){
+	double re = 0, im = 0;
+	for(uint16_t i = 0; i < count; i++){
+		double angle = 2 * M_PI * k * i / count;
+		re += samples[i] * cos(angle);
+		im -= samples[i] * sin(angle);
+	}
+	return sqrt(re * re + im * im);
+}
+
+// Harmonic k of the ideal waveform relative to its fundamental.  The square's edges give 1 / k, the ramp's
+// corners 1 / k^2; both are shaped by where the duty / symmetry edge falls
+static double ideal(uint8_t ramp, double duty, uint16_t k){
+	double shape = fabs(sin(M_PI * k * duty)) / fabs(sin(M_PI * duty));
+	return ramp ? shape / ((double)k * k) : shape / k;
+}
+
+static double sfdr(Kernel kernel, uint8_t ramp, uint16_t count, uint16_t tenths){
+	kernel(buf, count, tenths);
+
+	double fundamental	= harmonic(buf, count, 1);
+	double spur			= 1e-12;
+	for(uint16_t k = 2; k <= count / TEST_BAND; k++){
+		double error = fabs(harmonic(buf, count, k) / fundamental - ideal(ramp, tenths / 1000.0, k));
+		if(error > spur){
+			spur = error;
+		}
+	}
+	return -20 * log10(spur);
+}
+
+int main(void){
+	static const uint16_t tiers[] = { 50, 100, 250, 500, 1000, 2000, 4000 };
+	static const uint16_t duties[] = { 500, 333 };
+
+	printf("samples duty   square naive/blep (dB)   ramp naive/blamp (dB)\n");
+	for(uint8_t t = 0; t < sizeof(tiers) / sizeof(tiers[0]); t++){
+		for(uint8_t d = 0; d < sizeof(duties) / sizeof(duties[0]); d++){
+			double squareNaive	= sfdr(synthSquare, 0, tiers[t], duties[d]);
+			double squareBlep	= sfdr(synthSquareBlep, 0, tiers[t], duties[d]);
+			double rampNaive	= sfdr(synthRamp, 1, tiers[t], duties[d]);
+			double rampBlamp	= sfdr(synthRampBlamp, 1, tiers[t], duties[d]);
+
+			printf("%7u %4u   %6.1f / %6.1f          %6.1f / %6.1f\n", tiers[t], duties[d],
+					squareNaive, squareBlep, rampNaive, rampBlamp);
+
+			CHECK(squareBlep >= squareNaive + TEST_SQUARE_GAIN && squareBlep >= TEST_SQUARE_MIN,
+					"square, %u samples, duty %u: %.1f dB, naive %.1f dB", tiers[t], duties[d], squareBlep, squareNaive);
+			CHECK(rampBlamp >= rampNaive - TEST_RAMP_LOSS && rampBlamp >= TEST_RAMP_MIN,
+					"ramp, %u samples, symmetry %u: %.1f dB, naive %.1f dB", tiers[t], duties[d], rampBlamp, rampNaive);
+		}
+	}
+
+	printf("test_synth_sfdr: %s (%d failures)\n", failures ? "FAILED" : "passed", failures);
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}